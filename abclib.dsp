@@ -2043,6 +2043,10 @@ SOURCE=.\src\sat\bmc\bmcBmcG.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcBmcInc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcBmci.c
 # End Source File
 # Begin Source File
@@ -2991,6 +2995,10 @@ SOURCE=.\src\opt\dar\darMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dar\darPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dar\darPrec.c
 # End Source File
 # Begin Source File
@@ -3203,6 +3211,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -3731,6 +3743,10 @@ SOURCE=.\src\map\scl\sclLib.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclLibCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclLiberty.c
 # End Source File
 # Begin Source File
@@ -3751,6 +3767,10 @@ SOURCE=.\src\map\scl\sclSize.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\map\scl\sclSta.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\map\scl\sclSize.h
 # End Source File
 # Begin Source File
@@ -4143,6 +4163,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilPth.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilPth.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -4955,6 +4983,10 @@ SOURCE=.\src\aig\gia\giaCut.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCutEnum.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaDecs.c
 # End Source File
 # Begin Source File
@@ -5251,6 +5283,14 @@ SOURCE=.\src\aig\gia\giaSimBase.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSimPar.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaSimd.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -5627,6 +5667,10 @@ SOURCE=.\src\proof\cec\cecPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecProve.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSat.c
 # End Source File
 # Begin Source File
@@ -5991,6 +6035,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
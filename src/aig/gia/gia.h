@@ -42,8 +42,32 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// the wide object layout (compiled with ABC_USE_GIA_WIDE) uses 24-byte objects 
+// with 31-bit fanin diffs and 64-bit values, and lifts the object limit to 2^31-1 
+// (object IDs remain int); the literals of such AIGs do not fit into an int, so 
+// AIG construction, structural hashing, AIGER I/O and duplication use Gia_Lit_t;
+// the other packages still keep literals in int and handle up to 2^30 objects
+#ifdef ABC_USE_GIA_WIDE
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_VOID 0x7FFFFFFF
+#define GIA_OBJ_LOG 31
+#define GIA_OBJ_MAX 0x7FFFFFFF
+#else
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
+#define GIA_OBJ_LOG 29
+#define GIA_OBJ_MAX (1 << GIA_OBJ_LOG)
+#endif
+
+// the number of literals in one slot of the hash table (two fanin literals and the object ID)
+#define GIA_HASH_SLOT 3
+
+// simulation kernels (see giaSimd.c)
+#define GIA_SIMD_SCALAR  0
+#define GIA_SIMD_AVX2    1
+#define GIA_SIMD_AVX512  2
+#define GIA_SIMD_NUM     3
+#define GIA_SIMD_MIN     4        // the smallest number of words simulated by the kernels
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -54,14 +78,30 @@ typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
 
+// the literal of the AIG construction API
+#ifdef ABC_USE_GIA_WIDE
+typedef iword                        Gia_Lit_t;
+#else
+typedef int                          Gia_Lit_t;
+#endif
+
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_GIA_WIDE
+    unsigned       iRepr   : 31;  // representative node
+    unsigned       fProved :  1;  // marks the proved equivalence
+    unsigned       fFailed :  1;  // marks the failed equivalence
+    unsigned       fColorA :  1;  // marks cone of A
+    unsigned       fColorB :  1;  // marks cone of B
+    unsigned       fUnused : 29;  // unused
+#else
     unsigned       iRepr   : 28;  // representative node
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
     unsigned       fColorB :  1;  // marks cone of B
+#endif
 };
 
 typedef struct Gia_Plc_t_ Gia_Plc_t;
@@ -76,6 +116,20 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_USE_GIA_WIDE
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+    unsigned       fUnused:  28;  // unused
+
+    Gia_Lit_t      Value;         // application-specific value
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -87,6 +141,7 @@ struct Gia_Obj_t_
     unsigned       fPhase :   1;  // value under 000 pattern
 
     unsigned       Value;         // application-specific value
+#endif
 };
 // Value is currently used to store several types of information
 // - pointer to the next node in the hash table during structural hashing
@@ -109,8 +164,8 @@ struct Gia_Man_t_
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    Vec_Int_t      vHash;         // hash links
-    Vec_Int_t      vHTable;       // hash table
+    Gia_Lit_t *    pHTable;       // hash table (open addressing, GIA_HASH_SLOT literals per slot)
+    word           nHTable;       // the number of slots in the hash table
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -243,6 +298,15 @@ struct Gia_Man_t_
     Gia_Dat_t *    pUData;
 };
 
+// builds one piece of logic into its own shard (see Gia_ManShardBuild)
+typedef void (*Gia_ShardBuild_t)( Gia_Man_t * pShard, void * pUser, int iTask );
+
+// simulates a level chunk or a word range (see Gia_SimParRun)
+typedef void (*Gia_SimParTask_t)( void * pUser, int * pObjs, int nObjs, int wStart, int wStop );
+// processes a chunk of nodes of one level (see Gia_ManLevParRun)
+typedef void (*Gia_LevParTask_t)( void * pUser, int * pObjs, int nObjs, int iLevel, int iThread );
+// is called after all nodes of one level are processed (see Gia_ManLevParRun)
+typedef void (*Gia_LevParDone_t)( void * pUser, int iLevel );
 
 typedef struct Gps_Par_t_ Gps_Par_t;
 struct Gps_Par_t_
@@ -298,6 +362,7 @@ struct Gia_ParSim_t_
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
     int            fCheckMiter;   // check if miter outputs are non-zero
+    int            nThreads;      // the number of simulation threads
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
 };
@@ -374,6 +439,10 @@ struct Jf_Par_t_
     float          Epsilon;
     float *        pTimesArr;
     float *        pTimesReq;
+    char *         pCnfFile;     // writes CNF into this file instead of deriving it
+    int            nCnfVars;     // the number of CNF variables written
+    int            nCnfClauses;  // the number of CNF clauses written
+    int            nCnfLiterals; // the number of CNF literals written
 };
 
 static inline unsigned     Gia_ObjCutSign( unsigned ObjId )       { return (1 << (ObjId & 31));                                 }
@@ -443,6 +512,13 @@ static inline int          Gia_ManIsConst0Lit( int iLit )      { return (iLit ==
 static inline int          Gia_ManIsConst1Lit( int iLit )      { return (iLit == 1); }
 static inline int          Gia_ManIsConstLit( int iLit )       { return (iLit <= 1); }
 
+static inline Gia_Lit_t    Gia_Var2Lit( int Var, int c )                 { assert(Var >= 0 && !(c >> 1)); return (Gia_Lit_t)Var + Var + c; }
+static inline int          Gia_Lit2Var( Gia_Lit_t Lit )                  { assert(Lit >= 0); return (int)(Lit >> 1);                       }
+static inline int          Gia_LitIsCompl( Gia_Lit_t Lit )               { assert(Lit >= 0); return (int)(Lit & 1);                        }
+static inline Gia_Lit_t    Gia_LitNot( Gia_Lit_t Lit )                   { assert(Lit >= 0); return Lit ^ 1;                               }
+static inline Gia_Lit_t    Gia_LitNotCond( Gia_Lit_t Lit, int c )        { assert(Lit >= 0); return Lit ^ (Gia_Lit_t)(c > 0);              }
+static inline Gia_Lit_t    Gia_LitRegular( Gia_Lit_t Lit )               { assert(Lit >= 0); return Lit & ~(Gia_Lit_t)1;                   }
+
 static inline Gia_Obj_t *  Gia_Regular( Gia_Obj_t * p )        { return (Gia_Obj_t *)((ABC_PTRUINT_T)(p) & ~01);                           }
 static inline Gia_Obj_t *  Gia_Not( Gia_Obj_t * p )            { return (Gia_Obj_t *)((ABC_PTRUINT_T)(p) ^  01);                           }
 static inline Gia_Obj_t *  Gia_NotCond( Gia_Obj_t * p, int c ) { return (Gia_Obj_t *)((ABC_PTRUINT_T)(p) ^ (c));                           }
@@ -504,9 +580,9 @@ static inline int          Gia_ObjIsCand( Gia_Obj_t * pObj )                   {
 static inline int          Gia_ObjIsConst0( Gia_Obj_t * pObj )                 { return pObj->iDiff0 == GIA_NONE && pObj->iDiff1 == GIA_NONE;     } 
 static inline int          Gia_ManObjIsConst0( Gia_Man_t * p, Gia_Obj_t * pObj){ return pObj == p->pObjs;                        } 
 
-static inline int          Gia_Obj2Lit( Gia_Man_t * p, Gia_Obj_t * pObj )      { return Abc_Var2Lit(Gia_ObjId(p, Gia_Regular(pObj)), Gia_IsComplement(pObj)); }
-static inline Gia_Obj_t *  Gia_Lit2Obj( Gia_Man_t * p, int iLit )              { return Gia_NotCond(Gia_ManObj(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit));  }
-static inline int          Gia_ManCiLit( Gia_Man_t * p, int CiId )             { return Gia_Obj2Lit( p, Gia_ManCi(p, CiId) );                }
+static inline Gia_Lit_t    Gia_Obj2Lit( Gia_Man_t * p, Gia_Obj_t * pObj )      { return Gia_Var2Lit(Gia_ObjId(p, Gia_Regular(pObj)), Gia_IsComplement(pObj)); }
+static inline Gia_Obj_t *  Gia_Lit2Obj( Gia_Man_t * p, Gia_Lit_t iLit )        { return Gia_NotCond(Gia_ManObj(p, Gia_Lit2Var(iLit)), Gia_LitIsCompl(iLit));  }
+static inline Gia_Lit_t    Gia_ManCiLit( Gia_Man_t * p, int CiId )             { return Gia_Obj2Lit( p, Gia_ManCi(p, CiId) );                }
 
 static inline int          Gia_ManIdToCioId( Gia_Man_t * p, int Id )           { return Gia_ObjCioId( Gia_ManObj(p, Id) );                   }
 static inline int          Gia_ManCiIdToId( Gia_Man_t * p, int CiId )          { return Gia_ObjId( p, Gia_ManCi(p, CiId) );                  }
@@ -543,12 +619,12 @@ static inline int          Gia_ObjFaninId0p( Gia_Man_t * p, Gia_Obj_t * pObj ) {
 static inline int          Gia_ObjFaninId1p( Gia_Man_t * p, Gia_Obj_t * pObj ) { return Gia_ObjFaninId1( pObj, Gia_ObjId(p, pObj) );              }
 static inline int          Gia_ObjFaninId2p( Gia_Man_t * p, Gia_Obj_t * pObj ) { return (p->pMuxes && p->pMuxes[Gia_ObjId(p, pObj)]) ? Abc_Lit2Var(p->pMuxes[Gia_ObjId(p, pObj)]) : -1; }
 static inline int          Gia_ObjFaninIdp( Gia_Man_t * p, Gia_Obj_t * pObj, int n){ return n ? Gia_ObjFaninId1p(p, pObj) : Gia_ObjFaninId0p(p, pObj);     }
-static inline int          Gia_ObjFaninLit0( Gia_Obj_t * pObj, int ObjId )     { return Abc_Var2Lit( Gia_ObjFaninId0(pObj, ObjId), Gia_ObjFaninC0(pObj) ); }
-static inline int          Gia_ObjFaninLit1( Gia_Obj_t * pObj, int ObjId )     { return Abc_Var2Lit( Gia_ObjFaninId1(pObj, ObjId), Gia_ObjFaninC1(pObj) ); }
-static inline int          Gia_ObjFaninLit2( Gia_Man_t * p, int ObjId )        { return (p->pMuxes && p->pMuxes[ObjId]) ? p->pMuxes[ObjId] : -1;           }
-static inline int          Gia_ObjFaninLit0p( Gia_Man_t * p, Gia_Obj_t * pObj) { return Abc_Var2Lit( Gia_ObjFaninId0p(p, pObj), Gia_ObjFaninC0(pObj) );    }
-static inline int          Gia_ObjFaninLit1p( Gia_Man_t * p, Gia_Obj_t * pObj) { return Abc_Var2Lit( Gia_ObjFaninId1p(p, pObj), Gia_ObjFaninC1(pObj) );    }
-static inline int          Gia_ObjFaninLit2p( Gia_Man_t * p, Gia_Obj_t * pObj) { return (p->pMuxes && p->pMuxes[Gia_ObjId(p, pObj)]) ? p->pMuxes[Gia_ObjId(p, pObj)] : -1;    }
+static inline Gia_Lit_t    Gia_ObjFaninLit0( Gia_Obj_t * pObj, int ObjId )     { return Gia_Var2Lit( Gia_ObjFaninId0(pObj, ObjId), Gia_ObjFaninC0(pObj) ); }
+static inline Gia_Lit_t    Gia_ObjFaninLit1( Gia_Obj_t * pObj, int ObjId )     { return Gia_Var2Lit( Gia_ObjFaninId1(pObj, ObjId), Gia_ObjFaninC1(pObj) ); }
+static inline Gia_Lit_t    Gia_ObjFaninLit2( Gia_Man_t * p, int ObjId )        { return (p->pMuxes && p->pMuxes[ObjId]) ? (Gia_Lit_t)p->pMuxes[ObjId] : -1; }
+static inline Gia_Lit_t    Gia_ObjFaninLit0p( Gia_Man_t * p, Gia_Obj_t * pObj) { return Gia_Var2Lit( Gia_ObjFaninId0p(p, pObj), Gia_ObjFaninC0(pObj) );    }
+static inline Gia_Lit_t    Gia_ObjFaninLit1p( Gia_Man_t * p, Gia_Obj_t * pObj) { return Gia_Var2Lit( Gia_ObjFaninId1p(p, pObj), Gia_ObjFaninC1(pObj) );    }
+static inline Gia_Lit_t    Gia_ObjFaninLit2p( Gia_Man_t * p, Gia_Obj_t * pObj) { return (p->pMuxes && p->pMuxes[Gia_ObjId(p, pObj)]) ? (Gia_Lit_t)p->pMuxes[Gia_ObjId(p, pObj)] : -1;    }
 static inline void         Gia_ObjFlipFaninC0( Gia_Obj_t * pObj )              { assert( Gia_ObjIsCo(pObj) ); pObj->fCompl0 ^= 1;          }
 static inline int          Gia_ObjFaninNum( Gia_Man_t * p, Gia_Obj_t * pObj )  { if ( Gia_ObjIsMux(p, pObj) ) return 3; if ( Gia_ObjIsAnd(pObj) ) return 2; if ( Gia_ObjIsCo(pObj) ) return 1; return 0; }
 static inline int          Gia_ObjWhatFanin( Gia_Man_t * p, Gia_Obj_t * pObj, Gia_Obj_t * pFanin )  { if ( Gia_ObjFanin0(pObj) == pFanin ) return 0; if ( Gia_ObjFanin1(pObj) == pFanin ) return 1; if ( Gia_ObjFanin2(p, pObj) == pFanin ) return 2; assert(0); return -1; }
@@ -558,12 +634,12 @@ static inline int          Gia_ManPoIsConst( Gia_Man_t * p, int iPoIndex )     {
 static inline int          Gia_ManPoIsConst0( Gia_Man_t * p, int iPoIndex )    { return Gia_ManIsConst0Lit( Gia_ObjFaninLit0p(p, Gia_ManPo(p, iPoIndex)) ); }
 static inline int          Gia_ManPoIsConst1( Gia_Man_t * p, int iPoIndex )    { return Gia_ManIsConst1Lit( Gia_ObjFaninLit0p(p, Gia_ManPo(p, iPoIndex)) ); }
 
-static inline Gia_Obj_t *  Gia_ObjCopy( Gia_Man_t * p, Gia_Obj_t * pObj )      { return Gia_ManObj( p, Abc_Lit2Var(pObj->Value) );                              }
-static inline int          Gia_ObjLitCopy( Gia_Man_t * p, int iLit )           { return Abc_LitNotCond( Gia_ManObj(p, Abc_Lit2Var(iLit))->Value, Abc_LitIsCompl(iLit));     }
+static inline Gia_Obj_t *  Gia_ObjCopy( Gia_Man_t * p, Gia_Obj_t * pObj )      { return Gia_ManObj( p, Gia_Lit2Var(pObj->Value) );                              }
+static inline Gia_Lit_t    Gia_ObjLitCopy( Gia_Man_t * p, Gia_Lit_t iLit )     { return Gia_LitNotCond( Gia_ManObj(p, Gia_Lit2Var(iLit))->Value, Gia_LitIsCompl(iLit));     }
 
-static inline int          Gia_ObjFanin0Copy( Gia_Obj_t * pObj )               { return Abc_LitNotCond( Gia_ObjFanin0(pObj)->Value, Gia_ObjFaninC0(pObj) );     }
-static inline int          Gia_ObjFanin1Copy( Gia_Obj_t * pObj )               { return Abc_LitNotCond( Gia_ObjFanin1(pObj)->Value, Gia_ObjFaninC1(pObj) );     }
-static inline int          Gia_ObjFanin2Copy( Gia_Man_t * p, Gia_Obj_t * pObj ){ return Abc_LitNotCond(Gia_ObjFanin2(p, pObj)->Value, Gia_ObjFaninC2(p, pObj)); }
+static inline Gia_Lit_t    Gia_ObjFanin0Copy( Gia_Obj_t * pObj )               { return Gia_LitNotCond( Gia_ObjFanin0(pObj)->Value, Gia_ObjFaninC0(pObj) );     }
+static inline Gia_Lit_t    Gia_ObjFanin1Copy( Gia_Obj_t * pObj )               { return Gia_LitNotCond( Gia_ObjFanin1(pObj)->Value, Gia_ObjFaninC1(pObj) );     }
+static inline Gia_Lit_t    Gia_ObjFanin2Copy( Gia_Man_t * p, Gia_Obj_t * pObj ){ return Gia_LitNotCond(Gia_ObjFanin2(p, pObj)->Value, Gia_ObjFaninC2(p, pObj)); }
 
 static inline int          Gia_ObjCopyF( Gia_Man_t * p, int f, Gia_Obj_t * pObj )               { return Vec_IntEntry(&p->vCopies, Gia_ManObjNum(p) * f + Gia_ObjId(p,pObj));      }
 static inline void         Gia_ObjSetCopyF( Gia_Man_t * p, int f, Gia_Obj_t * pObj, int iLit )  { Vec_IntWriteEntry(&p->vCopies, Gia_ManObjNum(p) * f + Gia_ObjId(p,pObj), iLit);  }
@@ -580,9 +656,9 @@ static inline int          Gia_ObjFanin1CopyF( Gia_Man_t * p, int f, Gia_Obj_t *
 static inline int          Gia_ObjFanin0CopyArray( Gia_Man_t * p, Gia_Obj_t * pObj )            { return Abc_LitNotCond(Gia_ObjCopyArray(p, Gia_ObjFaninId0p(p,pObj)), Gia_ObjFaninC0(pObj));  }
 static inline int          Gia_ObjFanin1CopyArray( Gia_Man_t * p, Gia_Obj_t * pObj )            { return Abc_LitNotCond(Gia_ObjCopyArray(p, Gia_ObjFaninId1p(p,pObj)), Gia_ObjFaninC1(pObj));  }
 
-static inline Gia_Obj_t *  Gia_ObjFromLit( Gia_Man_t * p, int iLit )           { return Gia_NotCond( Gia_ManObj(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );  }
-static inline int          Gia_ObjToLit( Gia_Man_t * p, Gia_Obj_t * pObj )     { return Abc_Var2Lit( Gia_ObjId(p, Gia_Regular(pObj)), Gia_IsComplement(pObj) ); }
-static inline int          Gia_ObjPhaseRealLit( Gia_Man_t * p, int iLit )      { return Gia_ObjPhaseReal( Gia_ObjFromLit(p, iLit) );                            }
+static inline Gia_Obj_t *  Gia_ObjFromLit( Gia_Man_t * p, Gia_Lit_t iLit )     { return Gia_NotCond( Gia_ManObj(p, Gia_Lit2Var(iLit)), Gia_LitIsCompl(iLit) );  }
+static inline Gia_Lit_t    Gia_ObjToLit( Gia_Man_t * p, Gia_Obj_t * pObj )     { return Gia_Var2Lit( Gia_ObjId(p, Gia_Regular(pObj)), Gia_IsComplement(pObj) ); }
+static inline int          Gia_ObjPhaseRealLit( Gia_Man_t * p, Gia_Lit_t iLit ){ return Gia_ObjPhaseReal( Gia_ObjFromLit(p, iLit) );                            }
 
 static inline int          Gia_ObjLevelId( Gia_Man_t * p, int Id )             { return Vec_IntGetEntry(p->vLevels, Id);                    }
 static inline int          Gia_ObjLevel( Gia_Man_t * p, Gia_Obj_t * pObj )     { return Gia_ObjLevelId( p, Gia_ObjId(p,pObj) );             }
@@ -663,9 +739,10 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew;
+        if ( p->nObjs >= GIA_OBJ_MAX )
+            printf( "Hard limit on the number of nodes (%d) is reached. Quitting...\n", GIA_OBJ_MAX ), exit(1);
+        nObjNew = (int)Abc_MinWord( 2 * (word)p->nObjsAlloc, GIA_OBJ_MAX );
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
@@ -679,41 +756,40 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
-static inline int Gia_ManAppendCi( Gia_Man_t * p )  
+static inline Gia_Lit_t Gia_ManAppendCi( Gia_Man_t * p )  
 { 
     Gia_Obj_t * pObj = Gia_ManAppendObj( p );
     pObj->fTerm = 1;
     pObj->iDiff0 = GIA_NONE;
     pObj->iDiff1 = Vec_IntSize( p->vCis );
     Vec_IntPush( p->vCis, Gia_ObjId(p, pObj) );
-    return Gia_ObjId( p, pObj ) << 1;
+    return Gia_Var2Lit( Gia_ObjId(p, pObj), 0 );
 }
 
 extern void Gia_ManQuantSetSuppAnd( Gia_Man_t * p, Gia_Obj_t * pObj );
 extern void Gia_ManBuiltInSimPerform( Gia_Man_t * p, int iObj );
 
-static inline int Gia_ManAppendAnd( Gia_Man_t * p, int iLit0, int iLit1 )  
+static inline Gia_Lit_t Gia_ManAppendAnd( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     Gia_Obj_t * pObj = Gia_ManAppendObj( p );
-    assert( iLit0 >= 0 && Abc_Lit2Var(iLit0) < Gia_ManObjNum(p) );
-    assert( iLit1 >= 0 && Abc_Lit2Var(iLit1) < Gia_ManObjNum(p) );
-    assert( p->fGiaSimple || Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
+    assert( iLit0 >= 0 && Gia_Lit2Var(iLit0) < Gia_ManObjNum(p) );
+    assert( iLit1 >= 0 && Gia_Lit2Var(iLit1) < Gia_ManObjNum(p) );
+    assert( p->fGiaSimple || Gia_Lit2Var(iLit0) != Gia_Lit2Var(iLit1) );
     if ( iLit0 < iLit1 )
     {
-        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
-        pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
-        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit1));
-        pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0));
+        pObj->fCompl0 = (unsigned)(Gia_LitIsCompl(iLit0));
+        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit1));
+        pObj->fCompl1 = (unsigned)(Gia_LitIsCompl(iLit1));
     }
     else
     {
-        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
-        pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit0));
-        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit1));
-        pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit1));
+        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0));
+        pObj->fCompl1 = (unsigned)(Gia_LitIsCompl(iLit0));
+        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit1));
+        pObj->fCompl0 = (unsigned)(Gia_LitIsCompl(iLit1));
     }
     if ( p->pFanData )
     {
@@ -737,110 +813,110 @@ static inline int Gia_ManAppendAnd( Gia_Man_t * p, int iLit0, int iLit1 )
     }
     if ( p->vSuppWords )
         Gia_ManQuantSetSuppAnd( p, pObj );
-    return Gia_ObjId( p, pObj ) << 1;
+    return Gia_Var2Lit( Gia_ObjId(p, pObj), 0 );
 }
-static inline int Gia_ManAppendXorReal( Gia_Man_t * p, int iLit0, int iLit1 )  
+static inline Gia_Lit_t Gia_ManAppendXorReal( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     Gia_Obj_t * pObj = Gia_ManAppendObj( p );
-    assert( iLit0 >= 0 && Abc_Lit2Var(iLit0) < Gia_ManObjNum(p) );
-    assert( iLit1 >= 0 && Abc_Lit2Var(iLit1) < Gia_ManObjNum(p) );
-    assert( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
-    //assert( !Abc_LitIsCompl(iLit0) );
-    //assert( !Abc_LitIsCompl(iLit1) );
-    if ( Abc_Lit2Var(iLit0) > Abc_Lit2Var(iLit1) )
+    assert( iLit0 >= 0 && Gia_Lit2Var(iLit0) < Gia_ManObjNum(p) );
+    assert( iLit1 >= 0 && Gia_Lit2Var(iLit1) < Gia_ManObjNum(p) );
+    assert( Gia_Lit2Var(iLit0) != Gia_Lit2Var(iLit1) );
+    //assert( !Gia_LitIsCompl(iLit0) );
+    //assert( !Gia_LitIsCompl(iLit1) );
+    if ( Gia_Lit2Var(iLit0) > Gia_Lit2Var(iLit1) )
     {
-        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
-        pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
-        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit1));
-        pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0));
+        pObj->fCompl0 = (unsigned)(Gia_LitIsCompl(iLit0));
+        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit1));
+        pObj->fCompl1 = (unsigned)(Gia_LitIsCompl(iLit1));
     }
     else
     {
-        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
-        pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit0));
-        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit1));
-        pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit1));
+        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0));
+        pObj->fCompl1 = (unsigned)(Gia_LitIsCompl(iLit0));
+        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit1));
+        pObj->fCompl0 = (unsigned)(Gia_LitIsCompl(iLit1));
     }
     p->nXors++;
-    return Gia_ObjId( p, pObj ) << 1;
+    return Gia_Var2Lit( Gia_ObjId(p, pObj), 0 );
 }
-static inline int Gia_ManAppendMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )  
+static inline Gia_Lit_t Gia_ManAppendMuxReal( Gia_Man_t * p, Gia_Lit_t iLitC, Gia_Lit_t iLit1, Gia_Lit_t iLit0 )  
 { 
     Gia_Obj_t * pObj = Gia_ManAppendObj( p );
     assert( p->pMuxes != NULL );
-    assert( iLit0 >= 0 && Abc_Lit2Var(iLit0) < Gia_ManObjNum(p) );
-    assert( iLit1 >= 0 && Abc_Lit2Var(iLit1) < Gia_ManObjNum(p) );
-    assert( iLitC >= 0 && Abc_Lit2Var(iLitC) < Gia_ManObjNum(p) );
-    assert( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
-    assert( Abc_Lit2Var(iLitC) != Abc_Lit2Var(iLit0) );
-    assert( Abc_Lit2Var(iLitC) != Abc_Lit2Var(iLit1) );
-    assert( !Vec_IntSize(&p->vHTable) || !Abc_LitIsCompl(iLit1) );
-    if ( Abc_Lit2Var(iLit0) < Abc_Lit2Var(iLit1) )
+    assert( iLit0 >= 0 && Gia_Lit2Var(iLit0) < Gia_ManObjNum(p) );
+    assert( iLit1 >= 0 && Gia_Lit2Var(iLit1) < Gia_ManObjNum(p) );
+    assert( iLitC >= 0 && Gia_Lit2Var(iLitC) < Gia_ManObjNum(p) );
+    assert( Gia_Lit2Var(iLit0) != Gia_Lit2Var(iLit1) );
+    assert( Gia_Lit2Var(iLitC) != Gia_Lit2Var(iLit0) );
+    assert( Gia_Lit2Var(iLitC) != Gia_Lit2Var(iLit1) );
+    assert( !p->nHTable || !Gia_LitIsCompl(iLit1) );
+    if ( Gia_Lit2Var(iLit0) < Gia_Lit2Var(iLit1) )
     {
-        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
-        pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
-        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit1));
-        pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
-        p->pMuxes[Gia_ObjId(p, pObj)] = iLitC;
+        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0));
+        pObj->fCompl0 = (unsigned)(Gia_LitIsCompl(iLit0));
+        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit1));
+        pObj->fCompl1 = (unsigned)(Gia_LitIsCompl(iLit1));
+        p->pMuxes[Gia_ObjId(p, pObj)] = (unsigned)iLitC;
     }
     else
     {
-        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0));
-        pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit0));
-        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit1));
-        pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit1));
-        p->pMuxes[Gia_ObjId(p, pObj)] = Abc_LitNot(iLitC);
+        pObj->iDiff1  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0));
+        pObj->fCompl1 = (unsigned)(Gia_LitIsCompl(iLit0));
+        pObj->iDiff0  = (unsigned)(Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit1));
+        pObj->fCompl0 = (unsigned)(Gia_LitIsCompl(iLit1));
+        p->pMuxes[Gia_ObjId(p, pObj)] = (unsigned)Gia_LitNot(iLitC);
     }
     p->nMuxes++;
-    return Gia_ObjId( p, pObj ) << 1;
+    return Gia_Var2Lit( Gia_ObjId(p, pObj), 0 );
 }
-static inline int Gia_ManAppendBuf( Gia_Man_t * p, int iLit )  
+static inline Gia_Lit_t Gia_ManAppendBuf( Gia_Man_t * p, Gia_Lit_t iLit )  
 { 
     Gia_Obj_t * pObj = Gia_ManAppendObj( p );
-    assert( iLit >= 0 && Abc_Lit2Var(iLit) < Gia_ManObjNum(p) );
-    pObj->iDiff0  = pObj->iDiff1  = Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit);
-    pObj->fCompl0 = pObj->fCompl1 = Abc_LitIsCompl(iLit);
+    assert( iLit >= 0 && Gia_Lit2Var(iLit) < Gia_ManObjNum(p) );
+    pObj->iDiff0  = pObj->iDiff1  = Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit);
+    pObj->fCompl0 = pObj->fCompl1 = Gia_LitIsCompl(iLit);
     p->nBufs++;
-    return Gia_ObjId( p, pObj ) << 1;
+    return Gia_Var2Lit( Gia_ObjId(p, pObj), 0 );
 }
-static inline int Gia_ManAppendCo( Gia_Man_t * p, int iLit0 )  
+static inline Gia_Lit_t Gia_ManAppendCo( Gia_Man_t * p, Gia_Lit_t iLit0 )  
 { 
     Gia_Obj_t * pObj;
-    assert( iLit0 >= 0 && Abc_Lit2Var(iLit0) < Gia_ManObjNum(p) );
-    assert( !Gia_ObjIsCo(Gia_ManObj(p, Abc_Lit2Var(iLit0))) );
+    assert( iLit0 >= 0 && Gia_Lit2Var(iLit0) < Gia_ManObjNum(p) );
+    assert( !Gia_ObjIsCo(Gia_ManObj(p, Gia_Lit2Var(iLit0))) );
     pObj = Gia_ManAppendObj( p );    
     pObj->fTerm = 1;
-    pObj->iDiff0  = Gia_ObjId(p, pObj) - Abc_Lit2Var(iLit0);
-    pObj->fCompl0 = Abc_LitIsCompl(iLit0);
+    pObj->iDiff0  = Gia_ObjId(p, pObj) - Gia_Lit2Var(iLit0);
+    pObj->fCompl0 = Gia_LitIsCompl(iLit0);
     pObj->iDiff1  = Vec_IntSize( p->vCos );
     Vec_IntPush( p->vCos, Gia_ObjId(p, pObj) );
     if ( p->pFanData )
         Gia_ObjAddFanout( p, Gia_ObjFanin0(pObj), pObj );
-    return Gia_ObjId( p, pObj ) << 1;
+    return Gia_Var2Lit( Gia_ObjId(p, pObj), 0 );
 }
-static inline int Gia_ManAppendOr( Gia_Man_t * p, int iLit0, int iLit1 )
+static inline Gia_Lit_t Gia_ManAppendOr( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )
 {
-    return Abc_LitNot(Gia_ManAppendAnd( p, Abc_LitNot(iLit0), Abc_LitNot(iLit1) ));
+    return Gia_LitNot(Gia_ManAppendAnd( p, Gia_LitNot(iLit0), Gia_LitNot(iLit1) ));
 }
-static inline int Gia_ManAppendMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 )  
+static inline Gia_Lit_t Gia_ManAppendMux( Gia_Man_t * p, Gia_Lit_t iCtrl, Gia_Lit_t iData1, Gia_Lit_t iData0 )  
 { 
-    int iTemp0 = Gia_ManAppendAnd( p, Abc_LitNot(iCtrl), iData0 );
-    int iTemp1 = Gia_ManAppendAnd( p, iCtrl, iData1 );
-    return Abc_LitNotCond( Gia_ManAppendAnd( p, Abc_LitNot(iTemp0), Abc_LitNot(iTemp1) ), 1 );
+    Gia_Lit_t iTemp0 = Gia_ManAppendAnd( p, Gia_LitNot(iCtrl), iData0 );
+    Gia_Lit_t iTemp1 = Gia_ManAppendAnd( p, iCtrl, iData1 );
+    return Gia_LitNotCond( Gia_ManAppendAnd( p, Gia_LitNot(iTemp0), Gia_LitNot(iTemp1) ), 1 );
 }
-static inline int Gia_ManAppendMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 )  
+static inline Gia_Lit_t Gia_ManAppendMaj( Gia_Man_t * p, Gia_Lit_t iData0, Gia_Lit_t iData1, Gia_Lit_t iData2 )  
 { 
-    int iTemp0 = Gia_ManAppendOr( p, iData1, iData2 );
-    int iTemp1 = Gia_ManAppendAnd( p, iData0, iTemp0 );
-    int iTemp2 = Gia_ManAppendAnd( p, iData1, iData2 );
+    Gia_Lit_t iTemp0 = Gia_ManAppendOr( p, iData1, iData2 );
+    Gia_Lit_t iTemp1 = Gia_ManAppendAnd( p, iData0, iTemp0 );
+    Gia_Lit_t iTemp2 = Gia_ManAppendAnd( p, iData1, iData2 );
     return Gia_ManAppendOr( p, iTemp1, iTemp2 );
 }
-static inline int Gia_ManAppendXor( Gia_Man_t * p, int iLit0, int iLit1 )  
+static inline Gia_Lit_t Gia_ManAppendXor( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
-    return Gia_ManAppendMux( p, iLit0, Abc_LitNot(iLit1), iLit1 );
+    return Gia_ManAppendMux( p, iLit0, Gia_LitNot(iLit1), iLit1 );
 }
 
-static inline int Gia_ManAppendAnd2( Gia_Man_t * p, int iLit0, int iLit1 )  
+static inline Gia_Lit_t Gia_ManAppendAnd2( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     if ( !p->fGiaSimple )
     {
@@ -850,55 +926,55 @@ static inline int Gia_ManAppendAnd2( Gia_Man_t * p, int iLit0, int iLit1 )
             return iLit1 ? iLit0 : 0;
         if ( iLit0 == iLit1 )
             return iLit1;
-        if ( iLit0 == Abc_LitNot(iLit1) )
+        if ( iLit0 == Gia_LitNot(iLit1) )
             return 0;
     }
     return Gia_ManAppendAnd( p, iLit0, iLit1 );
 }
-static inline int Gia_ManAppendOr2( Gia_Man_t * p, int iLit0, int iLit1 )
+static inline Gia_Lit_t Gia_ManAppendOr2( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )
 {
-    return Abc_LitNot(Gia_ManAppendAnd2( p, Abc_LitNot(iLit0), Abc_LitNot(iLit1) ));
+    return Gia_LitNot(Gia_ManAppendAnd2( p, Gia_LitNot(iLit0), Gia_LitNot(iLit1) ));
 }
-static inline int Gia_ManAppendMux2( Gia_Man_t * p, int iCtrl, int iData1, int iData0 )  
+static inline Gia_Lit_t Gia_ManAppendMux2( Gia_Man_t * p, Gia_Lit_t iCtrl, Gia_Lit_t iData1, Gia_Lit_t iData0 )  
 { 
-    int iTemp0 = Gia_ManAppendAnd2( p, Abc_LitNot(iCtrl), iData0 );
-    int iTemp1 = Gia_ManAppendAnd2( p, iCtrl, iData1 );
-    return Abc_LitNotCond( Gia_ManAppendAnd2( p, Abc_LitNot(iTemp0), Abc_LitNot(iTemp1) ), 1 );
+    Gia_Lit_t iTemp0 = Gia_ManAppendAnd2( p, Gia_LitNot(iCtrl), iData0 );
+    Gia_Lit_t iTemp1 = Gia_ManAppendAnd2( p, iCtrl, iData1 );
+    return Gia_LitNotCond( Gia_ManAppendAnd2( p, Gia_LitNot(iTemp0), Gia_LitNot(iTemp1) ), 1 );
 }
-static inline int Gia_ManAppendMaj2( Gia_Man_t * p, int iData0, int iData1, int iData2 )  
+static inline Gia_Lit_t Gia_ManAppendMaj2( Gia_Man_t * p, Gia_Lit_t iData0, Gia_Lit_t iData1, Gia_Lit_t iData2 )  
 { 
-    int iTemp0 = Gia_ManAppendOr2( p, iData1, iData2 );
-    int iTemp1 = Gia_ManAppendAnd2( p, iData0, iTemp0 );
-    int iTemp2 = Gia_ManAppendAnd2( p, iData1, iData2 );
+    Gia_Lit_t iTemp0 = Gia_ManAppendOr2( p, iData1, iData2 );
+    Gia_Lit_t iTemp1 = Gia_ManAppendAnd2( p, iData0, iTemp0 );
+    Gia_Lit_t iTemp2 = Gia_ManAppendAnd2( p, iData1, iData2 );
     return Gia_ManAppendOr2( p, iTemp1, iTemp2 );
 }
-static inline int Gia_ManAppendXor2( Gia_Man_t * p, int iLit0, int iLit1 )  
+static inline Gia_Lit_t Gia_ManAppendXor2( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
-    return Gia_ManAppendMux2( p, iLit0, Abc_LitNot(iLit1), iLit1 );
+    return Gia_ManAppendMux2( p, iLit0, Gia_LitNot(iLit1), iLit1 );
 }
 
-static inline int Gia_ManAppendXorReal2( Gia_Man_t * p, int iLit0, int iLit1 )  
+static inline Gia_Lit_t Gia_ManAppendXorReal2( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     if ( !p->fGiaSimple )
     {
         if ( iLit0 < 2 )
-            return iLit0 ? Abc_LitNot(iLit1) : iLit1;
+            return iLit0 ? Gia_LitNot(iLit1) : iLit1;
         if ( iLit1 < 2 )
-            return iLit1 ? Abc_LitNot(iLit0) : iLit0;
+            return iLit1 ? Gia_LitNot(iLit0) : iLit0;
         if ( iLit0 == iLit1 )
             return 0;
-        if ( iLit0 == Abc_LitNot(iLit1) )
+        if ( iLit0 == Gia_LitNot(iLit1) )
             return 1;
     }
     return Gia_ManAppendXorReal( p, iLit0, iLit1 );
 }
 
-static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, int iLit0 )  
+static inline void Gia_ManPatchCoDriver( Gia_Man_t * p, int iCoIndex, Gia_Lit_t iLit0 )  
 {
     Gia_Obj_t * pObjCo  = Gia_ManCo( p, iCoIndex );
-    assert( Gia_ObjId(p, pObjCo) > Abc_Lit2Var(iLit0) );
-    pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Abc_Lit2Var(iLit0);
-    pObjCo->fCompl0 = Abc_LitIsCompl(iLit0);
+    assert( Gia_ObjId(p, pObjCo) > Gia_Lit2Var(iLit0) );
+    pObjCo->iDiff0  = Gia_ObjId(p, pObjCo) - Gia_Lit2Var(iLit0);
+    pObjCo->fCompl0 = Gia_LitIsCompl(iLit0);
 }
 
 #define GIA_ZER 1
@@ -1249,7 +1325,9 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
+extern void                Gia_AigerWritePar( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int nThreads );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1260,6 +1338,7 @@ extern Gia_Man_t *         Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, in
 extern Gia_Man_t *         Gia_ManAigSyn2( Gia_Man_t * p, int fOldAlgo, int fCoarsen, int fCutMin, int nRelaxRatio, int fDelayMin, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn3( Gia_Man_t * p, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn4( Gia_Man_t * p, int fVerbose, int fVeryVerbose );
+extern Gia_Man_t *         Gia_ManPerformDchNative( Gia_Man_t * p, void * pPars );
 /*=== giaBidec.c ===========================================================*/
 extern unsigned *          Gia_ManConvertAigToTruth( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vLeaves, Vec_Int_t * vTruth, Vec_Int_t * vVisited );
 extern Gia_Man_t *         Gia_ManPerformBidec( Gia_Man_t * p, int fVerbose );
@@ -1425,6 +1504,7 @@ extern Gia_Man_t *         Gia_ManSpecReduceInitFrames( Gia_Man_t * p, Abc_Cex_t
 extern void                Gia_ManEquivTransform( Gia_Man_t * p, int fVerbose );
 extern void                Gia_ManEquivImprove( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManEquivToChoices( Gia_Man_t * p, int nSnapshots );
+extern Gia_Man_t *         Gia_ManEquivToSibls( Gia_Man_t * p );
 extern int                 Gia_ManCountChoiceNodes( Gia_Man_t * p );
 extern int                 Gia_ManCountChoices( Gia_Man_t * p );
 extern int                 Gia_ManFilterEquivsForSpeculation( Gia_Man_t * pGia, char * pName1, char * pName2, int fLatchA, int fLatchB );
@@ -1465,18 +1545,21 @@ extern Gia_Man_t *         Gia_ManPerformFx( Gia_Man_t * p, int nNewNodesMax, in
 extern void                Gia_ManHashAlloc( Gia_Man_t * p ); 
 extern void                Gia_ManHashStart( Gia_Man_t * p ); 
 extern void                Gia_ManHashStop( Gia_Man_t * p );
-extern int                 Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 );
-extern int                 Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 );
-extern int                 Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 ); 
-extern int                 Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 ); 
-extern int                 Gia_ManHashXor( Gia_Man_t * p, int iLit0, int iLit1 ); 
-extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 );
-extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
-extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
+extern Gia_Lit_t           Gia_ManHashXorReal( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 );
+extern Gia_Lit_t           Gia_ManHashMuxReal( Gia_Man_t * p, Gia_Lit_t iLitC, Gia_Lit_t iLit1, Gia_Lit_t iLit0 );
+extern Gia_Lit_t           Gia_ManHashAnd( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 ); 
+extern Gia_Lit_t           Gia_ManHashOr( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 ); 
+extern Gia_Lit_t           Gia_ManHashXor( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 ); 
+extern Gia_Lit_t           Gia_ManHashMux( Gia_Man_t * p, Gia_Lit_t iCtrl, Gia_Lit_t iData1, Gia_Lit_t iData0 );
+extern Gia_Lit_t           Gia_ManHashMaj( Gia_Man_t * p, Gia_Lit_t iData0, Gia_Lit_t iData1, Gia_Lit_t iData2 );
+extern Gia_Lit_t           Gia_ManHashAndTry( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
-extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
-extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
+extern void                Gia_ManHashBench( Gia_Man_t * p, int nIters, int fVerbose );
+extern Vec_Ptr_t *         Gia_ManShardBuild( int nTasks, int nThreads, int fGiaSimple, Gia_ShardBuild_t pBuild, void * pUser );
+extern int                 Gia_ManShardAppend( Gia_Man_t * p, Gia_Man_t * pShard, int * pCiLits, Vec_Int_t * vCoLits );
+extern Gia_Lit_t           Gia_ManHashLookupInt( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 );
+extern Gia_Lit_t           Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashAndMulti2( Gia_Man_t * p, Vec_Int_t * vLits );
 extern int                 Gia_ManHashDualMiter( Gia_Man_t * p, Vec_Int_t * vOuts );
@@ -1520,6 +1603,7 @@ extern Gia_Man_t *         Gia_ManStart( int nObjsMax );
 extern void                Gia_ManStop( Gia_Man_t * p );  
 extern void                Gia_ManStopP( Gia_Man_t ** p );  
 extern double              Gia_ManMemory( Gia_Man_t * p );
+extern void                Gia_ManBenchLayout( Gia_Man_t * p, int nIters, int fVerbose );
 extern void                Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars ); 
 extern void                Gia_ManPrintStatsShort( Gia_Man_t * p ); 
 extern void                Gia_ManPrintMiterStatus( Gia_Man_t * p ); 
@@ -1607,9 +1691,24 @@ extern void                Gia_ManIncrSimStart( Gia_Man_t * p, int nWords, int n
 extern void                Gia_ManIncrSimSet( Gia_Man_t * p, Vec_Int_t * vObjLits );
 extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
+/*=== giaSimd.c ============================================================*/
+extern int                 Gia_SimdDetect();
+extern int                 Gia_SimdSetMode( int Mode );
+extern int                 Gia_SimdMode();
+extern char *              Gia_SimdName( int Mode );
+extern int                 Gia_SimdPadWords( int nWords );
+extern void                Gia_SimdAnd( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords );
+extern void                Gia_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords );
+extern void                Gia_ManSimdBench( Gia_Man_t * p, int nWords, int nIters, int nThreads, int fVerbose );
+/*=== giaSimPar.c ============================================================*/
+extern Vec_Wec_t *         Gia_ManSimParLevels( Gia_Man_t * p, int nWords, int nThreads );
+extern void                Gia_SimParRun( Vec_Wec_t * vLevels, int nWords, int nThreads, Gia_SimParTask_t pTask, void * pUser );
+extern Vec_Wec_t *         Gia_ManLevParCollect( Gia_Man_t * p );
+extern void                Gia_ManLevParRun( Vec_Wec_t * vLevels, int nThreads, Gia_LevParTask_t pTask, Gia_LevParDone_t pDone, void * pUser );
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern Vec_Wrd_t *         Gia_ManSimPatSimOutPar( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts, int nThreads );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
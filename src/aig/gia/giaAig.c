@@ -585,20 +585,24 @@ void Gia_ManReprFromAigRepr2( Aig_Man_t * pAig, Gia_Man_t * pGia )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+Gia_Man_t * Gia_ManCompress2Par( Gia_Man_t * p, int fUpdateLevel, int nThreads, int fVerbose )
 {
     Gia_Man_t * pGia;
     Aig_Man_t * pNew, * pTemp;
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     pNew = Gia_ManToAig( p, 0 );
-    pNew = Dar_ManCompress2( pTemp = pNew, 1, fUpdateLevel, 1, 0, fVerbose );
+    pNew = Dar_ManCompress2Par( pTemp = pNew, 1, fUpdateLevel, 1, 0, nThreads, fVerbose );
     Aig_ManStop( pTemp );
     pGia = Gia_ManFromAig( pNew );
     Aig_ManStop( pNew );
     Gia_ManTransferTiming( pGia, p );
     return pGia;
 }
+Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+{
+    return Gia_ManCompress2Par( p, fUpdateLevel, 1, fVerbose );
+}
 
 /**Function*************************************************************
 
@@ -637,6 +641,17 @@ Gia_Man_t * Gia_ManPerformDch( Gia_Man_t * p, void * pPars )
     int fUseMapping = 0;
     Gia_Man_t * pGia, * pGia1;
     Aig_Man_t * pNew;
+    if ( ((Dch_Pars_t *)pPars)->fUseNative && !p->pManTime )
+    {
+        pGia = Gia_ManPerformDchNative( p, pPars );
+        if ( !Gia_ManTestChoices(pGia) )
+        {
+            printf( "Gia_ManPerformDch(): The choices computed on GIA are not valid. Returning the original AIG.\n" );
+            Gia_ManStop( pGia );
+            pGia = Gia_ManDup( p );
+        }
+        return pGia;
+    }
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     if ( fUseMapping && Gia_ManHasMapping(p) )
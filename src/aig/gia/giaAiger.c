@@ -19,6 +19,13 @@
 
 ***********************************************************************/
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
@@ -27,6 +34,11 @@ ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
 
+// the number of bytes of the AND section decoded before the pages are released
+#define GIA_AIGER_CHUNK (1 << 26)
+// the number of AND gates in one chunk of the AND section written in parallel
+#define GIA_AIGER_PAR_CHUNK (1 << 16)
+
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -162,6 +174,51 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Releases the pages of the mapped file that were decoded.]
+
+  Description [Returns the beginning of the first page that is not released.
+  The pages are not modified, so they are reloaded from the file if touched.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned char * Gia_AigerReleasePages( unsigned char * pBeg, unsigned char * pEnd )
+{
+#ifndef _WIN32
+    word PageSize = (word)sysconf( _SC_PAGESIZE );
+    unsigned char * pBegPage = (unsigned char *)(((word)pBeg + PageSize - 1) & ~(PageSize - 1));
+    unsigned char * pEndPage = (unsigned char *)((word)pEnd & ~(PageSize - 1));
+    if ( pBegPage >= pEndPage )
+        return pBeg;
+    madvise( pBegPage, (size_t)(pEndPage - pBegPage), MADV_DONTNEED );
+    return pEndPage;
+#else
+    return pEnd;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the GIA literal of the AIGER literal.]
+
+  Description [The GIA literals of the AIGER variables are kept in an 
+  integer array. They are read back as unsigned, so that the literals of 
+  the wide build, which may exceed 2^31, survive the round trip.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Gia_Lit_t Gia_AigerNodeLit( Vec_Int_t * vNodes, unsigned uLit )
+{
+    return Gia_LitNotCond( (Gia_Lit_t)(unsigned)Vec_IntEntry(vNodes, uLit >> 1), uLit & 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -173,16 +230,21 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, word nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int fMapped, int nThreads )
 {
+    extern Vec_Wrd_t * Gia_AigerReadChunkTable( unsigned char * pContents, word nFileSize, unsigned char * pAnds, int nAnds, int * pnChunkSize );
+    extern int Gia_AigerReadAndsPar( unsigned char * pAnds, Vec_Wrd_t * vOffsets, int nChunkSize, int nAnds, int nCis, unsigned * pLits, int nThreads );
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
-    int iObj, iNode0, iNode1, fHieOnly = 0;
-    int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
+    Gia_Lit_t iObj, iNode0, iNode1;
+    int fHieOnly = 0;
+    int nTotal, nInputs, nOutputs, nLatches, nAnds, nChunkSize, nFailed, i;
+    Vec_Wrd_t * vOffsets;
+    unsigned * pLits = NULL;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
+    unsigned char * pDrivers, * pSymbols, * pCur, * pReleased;
     unsigned uLit0, uLit1, uLit;
 
     // read the parameters (M I L O A + B C J F)
@@ -239,6 +301,15 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         fprintf( stdout, "The number of objects does not match.\n" );
         return NULL;
     }
+    if ( (word)nTotal + nLatches + nOutputs + 1 > (word)GIA_OBJ_MAX )
+    {
+        fprintf( stdout, "The AIG with %.0f objects exceeds the limit (%d) of this build", (double)nTotal + nLatches + nOutputs + 1, GIA_OBJ_MAX );
+#ifndef ABC_USE_GIA_WIDE
+        fprintf( stdout, " (rebuild with ABC_USE_GIA_WIDE)" );
+#endif
+        fprintf( stdout, ".\n" );
+        return NULL;
+    }
     if ( nJust || nFair )
     {
         fprintf( stdout, "Reading AIGER files with liveness properties is currently not supported.\n" );
@@ -283,17 +354,46 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
-    // create the AND gates
+    // create the AND gates (the object array and the hash table are sized using the header)
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
+    // decode the AND section using several threads if the file has the chunk table
+    if ( nThreads > 1 && nAnds > 0 && (vOffsets = Gia_AigerReadChunkTable( (unsigned char *)pContents, nFileSize, pCur, nAnds, &nChunkSize )) )
+    {
+        pLits = ABC_ALLOC( unsigned, 2 * (size_t)nAnds );
+        nFailed = Gia_AigerReadAndsPar( pCur, vOffsets, nChunkSize, nAnds, nInputs + nLatches, pLits, nThreads );
+        pCur += Vec_WrdEntryLast( vOffsets );
+        Vec_WrdFree( vOffsets );
+        if ( nFailed )
+        {
+            fprintf( stdout, "The AND section of the AIGER file is corrupted (%d chunks cannot be decoded).\n", nFailed );
+            ABC_FREE( pLits );
+            Vec_IntFreeP( &vLits );
+            Vec_IntFree( vNodes );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
+    }
+    pReleased = pCur;
     for ( i = 0; i < nAnds; i++ )
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( pLits )
+        {
+            uLit0 = pLits[2*i+0];
+            uLit1 = pLits[2*i+1];
+        }
+        else
+        {
+            // when decoding from the mapped file, drop the pages decoded so far
+            if ( fMapped && pCur - pReleased >= GIA_AIGER_CHUNK )
+                pReleased = Gia_AigerReleasePages( pReleased, pCur );
+            uLit = ((unsigned)(i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+        iNode0 = Gia_AigerNodeLit( vNodes, uLit0 );
+        iNode1 = Gia_AigerNodeLit( vNodes, uLit1 );
         assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
         if ( !fGiaSimple && fSkipStrash )
         {
@@ -307,6 +407,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    ABC_FREE( pLits );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -319,7 +420,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         pCur = pDrivers;
         for ( i = 0; i < nLatches; i++ )
         {
-            uLit0 = atoi( (char *)pCur );   
+            uLit0 = (unsigned)strtoul( (char *)pCur, NULL, 10 );   
             while ( *pCur != ' ' && *pCur != '\n' ) 
                 pCur++;
             if ( *pCur == ' ' )
@@ -333,14 +434,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pCur++;
                 Vec_IntPush( vInits, 0 );
             }
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerNodeLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
-            uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            uLit0 = (unsigned)strtoul( (char *)pCur, NULL, 10 );   while ( *pCur++ != '\n' );
+            iNode0 = Gia_AigerNodeLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
 
@@ -351,14 +452,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         for ( i = 0; i < nLatches; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerNodeLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerNodeLit( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         Vec_IntFree( vLits );
@@ -366,9 +467,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
     // create the POs
     for ( i = 0; i < nOutputs; i++ )
-        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, nLatches + i) );
+        Gia_ManAppendCo( pNew, (Gia_Lit_t)(unsigned)Vec_IntEntry(vDrivers, nLatches + i) );
     for ( i = 0; i < nLatches; i++ )
-        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, i) );
+        Gia_ManAppendCo( pNew, (Gia_Lit_t)(unsigned)Vec_IntEntry(vDrivers, i) );
     Vec_IntFree( vDrivers );
 
     // create the latches
@@ -444,7 +545,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 }
                 else if ( *pType == 'n' )
                 {
-                    if ( Vec_IntSize(&pNew->vHTable) != 0 )
+                    if ( pNew->nHTable != 0 )
                     {
                         printf( "Structural hashing should be disabled to read internal nodes names.\n" );
                         fError = 1;
@@ -850,6 +951,13 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 if ( fVerbose ) printf( "Finished reading extension \"v\".\n" );
             }
             // read edge information
+            // skip the chunk table of the AND section (used before decoding the AND gates)
+            else if ( *pCur == 'z' )
+            {
+                pCur++;
+                pCur += Gia_AigerReadInt(pCur) + 4;
+                if ( fVerbose ) printf( "Finished reading extension \"z\".\n" );
+            }
             else if ( *pCur == 'w' )
             {
                 Vec_Int_t * vPairs;
@@ -1000,9 +1108,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, (word)nFileSize, fGiaSimple, fSkipStrash, fCheck, 0, 1 );
+}
+
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Sets the name and the spec of the AIG read from the file.]
 
   Description []
   
@@ -1010,35 +1123,103 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
   SeeAlso     []
 
+***********************************************************************/
+void Gia_AigerSetNames( Gia_Man_t * pNew, char * pFileName )
+{
+    char * pName;
+    if ( pNew == NULL )
+        return;
+    ABC_FREE( pNew->pName );
+    pName = Gia_FileNameGeneric( pFileName );
+    pNew->pName = Abc_UtilStrsav( pName );
+    ABC_FREE( pName );
+
+    assert( pNew->pSpec == NULL );
+    pNew->pSpec = Abc_UtilStrsav( pFileName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG from the memory-mapped AIGER file.]
+
+  Description [Maps the file privately (the symbol table is modified in place
+  by the reader) and decodes it without allocating the read buffer. Sets 
+  *pfMapped to 0 if the file cannot be mapped, in which case the caller reads it.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadMapped( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads, int * pfMapped )
+{
+    *pfMapped = 0;
+#ifndef _WIN32
+    Gia_Man_t * pNew;
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+    *pfMapped = 1;
+    pNew = Gia_AigerReadFromMemoryInt( pContents, (word)Stat.st_size, fGiaSimple, fSkipStrash, fCheck, 1, nThreads );
+    munmap( pContents, (size_t)Stat.st_size );
+    Gia_AigerSetNames( pNew, pFileName );
+    return pNew;
+#else
+    return NULL;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [If nThreads > 1 and the file contains the chunk table of 
+  the AND section (extension "z"), the AND gates are decoded in parallel.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
-    char * pName, * pContents;
-    int nFileSize;
+    char * pContents;
+    int nFileSize, fMapped;
     int RetValue;
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
+    pNew = Gia_AigerReadMapped( pFileName, fGiaSimple, fSkipStrash, fCheck, nThreads, &fMapped );
+    if ( fMapped )
+        return pNew;
+    // read the file into the buffer
     nFileSize = Gia_FileSize( pFileName );
     pFile = fopen( pFileName, "rb" );
     pContents = ABC_ALLOC( char, nFileSize );
     RetValue = fread( pContents, nFileSize, 1, pFile );
     fclose( pFile );
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+    pNew = Gia_AigerReadFromMemoryInt( pContents, (word)nFileSize, fGiaSimple, fSkipStrash, fCheck, 0, nThreads );
     ABC_FREE( pContents );
-    if ( pNew )
-    {
-        ABC_FREE( pNew->pName );
-        pName = Gia_FileNameGeneric( pFileName );
-        pNew->pName = Abc_UtilStrsav( pName );
-        ABC_FREE( pName );
-
-        assert( pNew->pSpec == NULL );
-        pNew->pSpec = Abc_UtilStrsav( pFileName );
-    }
+    Gia_AigerSetNames( pNew, pFileName );
     return pNew;
 }
 
@@ -1060,7 +1241,8 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p )
 {
     Vec_Str_t * vBuffer;
     Gia_Obj_t * pObj;
-    int nNodes = 0, i, uLit, uLit0, uLit1; 
+    int nNodes = 0, i;
+    unsigned uLit, uLit0, uLit1; 
     // set the node numbers to be used in the output file
     Gia_ManConst0(p)->Value = nNodes++;
     Gia_ManForEachCi( p, pObj, i )
@@ -1085,28 +1267,28 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p )
     // write latch drivers
     Gia_ManForEachRi( p, pObj, i )
     {
-        uLit = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        Vec_StrPrintNum( vBuffer, uLit );
+        uLit = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+        Vec_StrPrintF( vBuffer, "%u", uLit );
         Vec_StrPrintStr( vBuffer, "\n" );
     }
 
     // write PO drivers
     Gia_ManForEachPo( p, pObj, i )
     {
-        uLit = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        Vec_StrPrintNum( vBuffer, uLit );
+        uLit = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+        Vec_StrPrintF( vBuffer, "%u", uLit );
         Vec_StrPrintStr( vBuffer, "\n" );
     }
     // write the nodes into the buffer
     Gia_ManForEachAnd( p, pObj, i )
     {
-        uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
-        uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
+        uLit  = Gia_Var2Lit( Gia_ObjValue(pObj), 0 );
+        uLit0 = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+        uLit1 = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
         assert( uLit0 != uLit1 );
         if ( uLit0 > uLit1 )
         {
-            int Temp = uLit0;
+            unsigned Temp = uLit0;
             uLit0 = uLit1;
             uLit1 = Temp;
         }
@@ -1134,7 +1316,8 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 {
     Vec_Str_t * vBuffer;
     Gia_Obj_t * pObj;
-    int nNodes = 0, i, uLit, uLit0, uLit1; 
+    int nNodes = 0, i;
+    unsigned uLit, uLit0, uLit1; 
     // set the node numbers to be used in the output file
     Gia_ManConst0(p)->Value = nNodes++;
     Gia_ManForEachObjVec( vCis, p, pObj, i )
@@ -1168,8 +1351,8 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
         assert( Gia_ObjIsCo(pObj) );
         if ( i < Vec_IntSize(vCos) - nRegs )
             continue;
-        uLit = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        Vec_StrPrintNum( vBuffer, uLit );
+        uLit = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+        Vec_StrPrintF( vBuffer, "%u", uLit );
         Vec_StrPrintStr( vBuffer, "\n" );
     }
     // write output drivers
@@ -1178,21 +1361,21 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
         assert( Gia_ObjIsCo(pObj) );
         if ( i >= Vec_IntSize(vCos) - nRegs )
             continue;
-        uLit = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        Vec_StrPrintNum( vBuffer, uLit );
+        uLit = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+        Vec_StrPrintF( vBuffer, "%u", uLit );
         Vec_StrPrintStr( vBuffer, "\n" );
     }
 
     // write the nodes into the buffer
     Gia_ManForEachObjVec( vAnds, p, pObj, i )
     {
-        uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
-        uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
+        uLit  = Gia_Var2Lit( Gia_ObjValue(pObj), 0 );
+        uLit0 = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+        uLit1 = Gia_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
         assert( uLit0 != uLit1 );
         if ( uLit0 > uLit1 )
         {
-            int Temp = uLit0;
+            unsigned Temp = uLit0;
             uLit0 = uLit1;
             uLit1 = Temp;
         }
@@ -1207,7 +1390,9 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If nThreads > 0, the AND section is encoded in chunks using
+  nThreads threads and the chunk table is written as extension "z", which
+  allows the reader to decode the AND gates in parallel.]
   
   SideEffects []
 
@@ -1216,14 +1401,23 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 ***********************************************************************/
 void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine )
 {
+    Gia_AigerWritePar( pInit, pFileName, fWriteSymbols, fCompact, fWriteNewLine, 0 );
+}
+void Gia_AigerWritePar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int nThreads )
+{
+    extern Vec_Ptr_t * Gia_AigerWriteAndsPar( Gia_Man_t * p, int nChunkSize, int nThreads );
+    extern Vec_Str_t * Gia_AigerWriteChunkTable( Vec_Ptr_t * vChunks, int nChunkSize );
+    extern void Gia_AigerWriteChunkTrailer( FILE * pFile, word Pos );
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
+    Vec_Ptr_t * vChunks = NULL;
     int i, nBufferSize, Pos;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
+    word PosTable = 0;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
     if ( Gia_ManCoNum(pInit) == 0 )
@@ -1271,10 +1465,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            fprintf( pFile, "%u\n", (unsigned)Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            fprintf( pFile, "%u\n", (unsigned)Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
@@ -1286,32 +1480,42 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+    if ( nThreads > 0 )
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        // write the nodes in chunks encoded in parallel
+        vChunks = Gia_AigerWriteAndsPar( p, GIA_AIGER_PAR_CHUNK, nThreads );
+        Vec_PtrForEachEntry( Vec_Str_t *, vChunks, vStrExt, i )
+            fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+    }
+    else
+    {
+        // write the nodes into the buffer
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            uLit  = Gia_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
         }
-    }
-    assert( Pos < nBufferSize );
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1551,11 +1755,26 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fwrite( p->pName, 1, strlen(p->pName), pFile );
         fprintf( pFile, "%c", '\0' );
     }
+    // write the chunk table of the AND section
+    if ( vChunks )
+    {
+        PosTable = (word)ftell( pFile );
+        fprintf( pFile, "z" );
+        vStrExt = Gia_AigerWriteChunkTable( vChunks, GIA_AIGER_PAR_CHUNK );
+        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
+        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Vec_StrFree( vStrExt );
+        Vec_VecFree( (Vec_Vec_t *)vChunks );
+        if ( fVerbose ) printf( "Finished writing extension \"z\".\n" );
+    }
     // write comments
     if ( fWriteNewLine )
         fprintf( pFile, "c\n" );
     fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
     fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    // the trailer pointing to the chunk table is the last item in the file
+    if ( PosTable )
+        Gia_AigerWriteChunkTrailer( pFile, PosTable );
     fclose( pFile );
     if ( p != pInit )
     {
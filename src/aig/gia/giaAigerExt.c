@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -317,6 +318,211 @@ Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking )
     return Vec_StrAllocArray( (char *)pBuffer, 4*Vec_IntSize(vPacking) );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Read/write the chunk table of the AND section.]
+
+  Description [The table is written as extension "z". Its payload is the 
+  number of AND gates in one chunk, the number of chunks, and the offsets 
+  (relative to the beginning of the AND section) where each chunk begins, 
+  followed by the offset of the end of the AND section. Each offset takes 
+  two 4-byte ints (the high and the low part). Because the extensions 
+  follow the AND section, the file ends with a trailer composed of the 
+  position of the extension in the file (two 4-byte ints) and the magic 
+  string "GIAZ", which allows the reader to find the table before decoding
+  the AND gates. Tools that do not know the extension see it as a comment.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Gia_AigerReadWord( unsigned char * pPos )
+{
+    return ((word)(unsigned)Gia_AigerReadInt(pPos) << 32) | (word)(unsigned)Gia_AigerReadInt(pPos + 4);
+}
+static inline void Gia_AigerWriteWord( unsigned char * pPos, word Value )
+{
+    Gia_AigerWriteInt( pPos, (int)(Value >> 32) );
+    Gia_AigerWriteInt( pPos + 4, (int)(Value & 0xFFFFFFFF) );
+}
+Vec_Wrd_t * Gia_AigerReadChunkTable( unsigned char * pContents, word nFileSize, unsigned char * pAnds, int nAnds, int * pnChunkSize )
+{
+    unsigned char * pCur, * pStop = pContents + nFileSize;
+    Vec_Wrd_t * vOffsets;
+    word Pos;
+    int i, nSize, nChunkSize, nChunks;
+    if ( nFileSize < 12 || memcmp(pStop - 4, "GIAZ", 4) )
+        return NULL;
+    Pos = Gia_AigerReadWord( pStop - 12 );
+    if ( nFileSize < 13 || Pos > nFileSize - 13 || pContents[Pos] != 'z' || pAnds > pContents + Pos )
+        return NULL;
+    pCur = pContents + Pos + 1;
+    nSize      = Gia_AigerReadInt( pCur );  pCur += 4;
+    nChunkSize = Gia_AigerReadInt( pCur );  pCur += 4;
+    nChunks    = Gia_AigerReadInt( pCur );  pCur += 4;
+    if ( nChunkSize <= 0 || nChunks != (nAnds + nChunkSize - 1) / nChunkSize || (word)nSize != 8 + 8 * (word)(nChunks + 1) || 8 * (word)(nChunks + 1) > (word)(pStop - pCur) )
+        return NULL;
+    // the offsets start at 0, do not decrease, and do not go past the table
+    vOffsets = Vec_WrdAlloc( nChunks + 1 );
+    for ( i = 0; i <= nChunks; i++, pCur += 8 )
+    {
+        word Offset = Gia_AigerReadWord( pCur );
+        if ( (i == 0 && Offset != 0) || (i > 0 && Offset < Vec_WrdEntryLast(vOffsets)) || Offset > (word)(pContents + Pos - pAnds) )
+        {
+            Vec_WrdFree( vOffsets );
+            return NULL;
+        }
+        Vec_WrdPush( vOffsets, Offset );
+    }
+    *pnChunkSize = nChunkSize;
+    return vOffsets;
+}
+Vec_Str_t * Gia_AigerWriteChunkTable( Vec_Ptr_t * vChunks, int nChunkSize )
+{
+    Vec_Str_t * vChunk;
+    int i, nChunks = Vec_PtrSize(vChunks);
+    unsigned char * pBuffer = ABC_ALLOC( unsigned char, 8 + 8 * (nChunks + 1) );
+    word Offset = 0;
+    Gia_AigerWriteInt( pBuffer, nChunkSize );
+    Gia_AigerWriteInt( pBuffer + 4, nChunks );
+    Vec_PtrForEachEntry( Vec_Str_t *, vChunks, vChunk, i )
+    {
+        Gia_AigerWriteWord( pBuffer + 8 + 8 * i, Offset );
+        Offset += Vec_StrSize(vChunk);
+    }
+    Gia_AigerWriteWord( pBuffer + 8 + 8 * nChunks, Offset );
+    return Vec_StrAllocArray( (char *)pBuffer, 8 + 8 * (nChunks + 1) );
+}
+void Gia_AigerWriteChunkTrailer( FILE * pFile, word Pos )
+{
+    unsigned char Buffer[8];
+    Gia_AigerWriteWord( Buffer, Pos );
+    fwrite( Buffer, 1, 8, pFile );
+    fwrite( "GIAZ", 1, 4, pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes/encodes the AND section in chunks using several threads.]
+
+  Description [The decoder fills in the array of 2*nAnds literals, which 
+  are the fanin literals of each AND gate in the file numbering. Decoding 
+  of each chunk is bounded by the next chunk offset. A chunk is marked as 
+  failed if it overruns its end, does not end exactly at it, or produces 
+  a literal that does not precede the AND gate. The decoder returns the 
+  number of failed chunks, in which case the file is rejected.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_AigerPar_t_ Gia_AigerPar_t;
+struct Gia_AigerPar_t_
+{
+    Gia_Man_t *     p;            // the AIG to write
+    Vec_Ptr_t *     vChunks;      // encoded chunks
+    unsigned char * pAnds;        // the AND section
+    Vec_Wrd_t *     vOffsets;     // the chunk offsets
+    unsigned *      pLits;        // decoded literals
+    char *          pFailed;      // chunks that failed to decode
+    int             nChunkSize;   // the number of ANDs in one chunk
+    int             nAnds;        // the number of ANDs
+    int             nCis;         // the number of CIs
+};
+static inline int Gia_AigerReadUnsignedBounded( unsigned char ** ppPos, unsigned char * pStop, unsigned * pValue )
+{
+    unsigned x = 0, i = 0;
+    unsigned char ch;
+    do {
+        if ( *ppPos >= pStop || i == 5 )
+            return 0;
+        ch = *(*ppPos)++;
+        x |= (unsigned)(ch & 0x7f) << (7 * i++);
+    } while ( ch & 0x80 );
+    *pValue = x;
+    return 1;
+}
+static void Gia_AigerReadChunk( void * pUser, int iChunk, int iThread )
+{
+    Gia_AigerPar_t * p = (Gia_AigerPar_t *)pUser;
+    unsigned char * pCur  = p->pAnds + Vec_WrdEntry(p->vOffsets, iChunk);
+    unsigned char * pStop = p->pAnds + Vec_WrdEntry(p->vOffsets, iChunk+1);
+    int i, iStop = Abc_MinInt( (iChunk + 1) * p->nChunkSize, p->nAnds );
+    unsigned uLit, uDiff0, uDiff1;
+    if ( pCur > pStop )
+    {
+        p->pFailed[iChunk] = 1;
+        return;
+    }
+    for ( i = iChunk * p->nChunkSize; i < iStop; i++ )
+    {
+        uLit = ((unsigned)(i + 1 + p->nCis) << 1);
+        if ( !Gia_AigerReadUnsignedBounded( &pCur, pStop, &uDiff1 ) || uDiff1 == 0 || uDiff1 > uLit ||
+             !Gia_AigerReadUnsignedBounded( &pCur, pStop, &uDiff0 ) || uDiff0 > uLit - uDiff1 )
+        {
+            p->pFailed[iChunk] = 1;
+            return;
+        }
+        p->pLits[2*i+1] = uLit - uDiff1;
+        p->pLits[2*i+0] = uLit - uDiff1 - uDiff0;
+    }
+    if ( pCur != pStop )
+        p->pFailed[iChunk] = 1;
+}
+int Gia_AigerReadAndsPar( unsigned char * pAnds, Vec_Wrd_t * vOffsets, int nChunkSize, int nAnds, int nCis, unsigned * pLits, int nThreads )
+{
+    Gia_AigerPar_t Par, * p = &Par;
+    int i, nChunks = Vec_WrdSize(vOffsets) - 1, nFailed = 0;
+    memset( p, 0, sizeof(Gia_AigerPar_t) );
+    p->pAnds      = pAnds;
+    p->vOffsets   = vOffsets;
+    p->pLits      = pLits;
+    p->pFailed    = ABC_CALLOC( char, nChunks );
+    p->nChunkSize = nChunkSize;
+    p->nAnds      = nAnds;
+    p->nCis       = nCis;
+    Util_PthRun( nThreads, nChunks, Gia_AigerReadChunk, p );
+    for ( i = 0; i < nChunks; i++ )
+        nFailed += p->pFailed[i];
+    ABC_FREE( p->pFailed );
+    return nFailed;
+}
+static void Gia_AigerWriteChunk( void * pUser, int iChunk, int iThread )
+{
+    Gia_AigerPar_t * p = (Gia_AigerPar_t *)pUser;
+    Vec_Str_t * vChunk = (Vec_Str_t *)Vec_PtrEntry( p->vChunks, iChunk );
+    int i, iStop = Abc_MinInt( (iChunk + 1) * p->nChunkSize, p->nAnds );
+    unsigned uLit, uLit0, uLit1;
+    for ( i = 1 + p->nCis + iChunk * p->nChunkSize; i < 1 + p->nCis + iStop; i++ )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( p->p, i );
+        assert( Gia_ObjIsAnd(pObj) );
+        uLit  = Gia_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        Gia_AigerWriteUnsigned( vChunk, uLit  - uLit1 );
+        Gia_AigerWriteUnsigned( vChunk, uLit1 - uLit0 );
+    }
+}
+Vec_Ptr_t * Gia_AigerWriteAndsPar( Gia_Man_t * p, int nChunkSize, int nThreads )
+{
+    Gia_AigerPar_t Par, * pPar = &Par;
+    int i, nChunks = (Gia_ManAndNum(p) + nChunkSize - 1) / nChunkSize;
+    assert( Gia_ManIsNormalized(p) );
+    memset( pPar, 0, sizeof(Gia_AigerPar_t) );
+    pPar->p          = p;
+    pPar->vChunks    = Vec_PtrAlloc( nChunks );
+    pPar->nChunkSize = nChunkSize;
+    pPar->nAnds      = Gia_ManAndNum(p);
+    pPar->nCis       = Gia_ManCiNum(p);
+    for ( i = 0; i < nChunks; i++ )
+        Vec_PtrPush( pPar->vChunks, Vec_StrAlloc( 3 * nChunkSize ) );
+    Util_PthRun( nThreads, nChunks, Gia_AigerWriteChunk, pPar );
+    return pPar->vChunks;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
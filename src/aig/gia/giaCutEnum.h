@@ -0,0 +1,268 @@
+/**CFile****************************************************************
+
+  FileName    [giaCutEnum.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Cut enumeration primitives shared by the LUT mappers.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaCutEnum.h,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__aig__gia__giaCutEnum_h
+#define ABC__aig__gia__giaCutEnum_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "gia.h"
+
+#if defined(__SSE2__) && !defined(ABC_NO_SIMD)
+#define GIA_CUT_SSE
+#include <emmintrin.h>
+#endif
+
+ABC_NAMESPACE_HEADER_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+// The vector version of the containment check loads GIA_CUT_LOAD entries
+// starting from the first leaf of the larger cut, whatever the number of
+// its leaves is. This array should be readable that far; the entries past
+// the last leaf are ignored. Larger cuts are handled by the scalar code.
+#define GIA_CUT_LOAD       8
+
+// the largest number of cuts in one structure-of-arrays cut set
+#define GIA_CUT_SOA_MAX   32
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// sizes and signatures of a cut set stored apart from the leaves, so that
+// the pairs of cuts exceeding the LUT size are filtered by scanning two
+// contiguous arrays instead of visiting the cuts one by one
+typedef struct Gia_CutSoa_t_ Gia_CutSoa_t;
+struct Gia_CutSoa_t_
+{
+    int            nCuts;                    // the number of cuts
+    int            pSizes[GIA_CUT_SOA_MAX];  // the numbers of leaves
+    word           pSigns[GIA_CUT_SOA_MAX];  // the signatures
+};
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// iterates through the cuts of the set that may be merged with the given cut
+#define Gia_CutSoaForEachPair( pSoa, nSize, Sign, nLutSize, Mask, k )                           \
+    for ( Mask = Gia_CutSoaPairMask(pSoa, nSize, Sign, nLutSize);                                \
+          Mask && ((k = Gia_CutFirstBit(Mask)), 1); Mask &= Mask - 1 )
+
+static inline int Gia_CutFirstBit( unsigned Mask )
+{
+#if defined(__GNUC__)
+    return __builtin_ctz( Mask );
+#else
+    return Gia_WordFindFirstBit( Mask );
+#endif
+}
+static inline int Gia_CutCountBits( word i )
+{
+    i = i - ((i >> 1) & ABC_CONST(0x5555555555555555));
+    i = (i & ABC_CONST(0x3333333333333333)) + ((i >> 2) & ABC_CONST(0x3333333333333333));
+    i = ((i + (i >> 4)) & ABC_CONST(0x0F0F0F0F0F0F0F0F));
+    return (i*(ABC_CONST(0x0101010101010101)))>>56;
+}
+static inline word Gia_CutGetSign( int * pLeaves, int nLeaves )
+{
+    word Sign = 0; int i;
+    for ( i = 0; i < nLeaves; i++ )
+        Sign |= ((word)1) << (pLeaves[i] & 0x3F);
+    return Sign;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Structure-of-arrays cut set.]
+
+  Description [Gia_CutSoaPairMask() returns the mask of the cuts that
+  may be merged with the given cut without exceeding the LUT size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_CutSoaClear( Gia_CutSoa_t * p )
+{
+    p->nCuts = 0;
+}
+static inline void Gia_CutSoaPush( Gia_CutSoa_t * p, int nSize, word Sign )
+{
+    assert( p->nCuts < GIA_CUT_SOA_MAX );
+    p->pSizes[p->nCuts] = nSize;
+    p->pSigns[p->nCuts] = Sign;
+    p->nCuts++;
+}
+static inline unsigned Gia_CutSoaPairMask( Gia_CutSoa_t * p, int nSize, word Sign, int nLutSize )
+{
+    unsigned Mask = 0; int k;
+    for ( k = 0; k < p->nCuts; k++ )
+        Mask |= (unsigned)(nSize + p->pSizes[k] <= nLutSize || Gia_CutCountBits(Sign | p->pSigns[k]) <= nLutSize) << k;
+    return Mask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two sorted leaf arrays.]
+
+  Description [Returns the number of leaves in the merged cut, or -1 if
+  it has more than nLutSize leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_CutMergeOrder( int * pC0, int nSize0, int * pC1, int nSize1, int * pC, int nLutSize )
+{
+    int i, k, c;
+    // the case of the largest cut sizes
+    if ( nSize0 == nLutSize && nSize1 == nLutSize )
+    {
+        for ( i = 0; i < nSize0; i++ )
+        {
+            if ( pC0[i] != pC1[i] )  return -1;
+            pC[i] = pC0[i];
+        }
+        return nLutSize;
+    }
+    // compare two cuts with different numbers
+    i = k = c = 0;
+    if ( nSize0 == 0 ) goto FlushCut1;
+    if ( nSize1 == 0 ) goto FlushCut0;
+    while ( 1 )
+    {
+        if ( c == nLutSize ) return -1;
+        if ( pC0[i] < pC1[k] )
+        {
+            pC[c++] = pC0[i++];
+            if ( i >= nSize0 ) goto FlushCut1;
+        }
+        else if ( pC0[i] > pC1[k] )
+        {
+            pC[c++] = pC1[k++];
+            if ( k >= nSize1 ) goto FlushCut0;
+        }
+        else
+        {
+            pC[c++] = pC0[i++]; k++;
+            if ( i >= nSize0 ) goto FlushCut1;
+            if ( k >= nSize1 ) goto FlushCut0;
+        }
+    }
+
+FlushCut0:
+    if ( c + nSize0 > nLutSize + i ) return -1;
+    while ( i < nSize0 )
+        pC[c++] = pC0[i++];
+    return c;
+
+FlushCut1:
+    if ( c + nSize1 > nLutSize + k ) return -1;
+    while ( k < nSize1 )
+        pC[c++] = pC1[k++];
+    return c;
+}
+
+#ifdef GIA_CUT_SSE
+static inline unsigned Gia_CutVecMask( __m128i Lo, __m128i Hi )
+{
+    return (unsigned)_mm_movemask_ps(_mm_castsi128_ps(Lo)) | ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(Hi)) << 4);
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the second sorted leaf array is contained in the first.]
+
+  Description [The vector version requires the base array to be readable
+  for GIA_CUT_LOAD entries (see above).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_CutIsContainedOrderScalar( int * pBase, int nSizeB, int * pCut, int nSizeC )
+{
+    int i, k;
+    if ( nSizeB == nSizeC )
+    {
+        for ( i = 0; i < nSizeB; i++ )
+            if ( pBase[i] != pCut[i] )
+                return 0;
+        return 1;
+    }
+    assert( nSizeB > nSizeC );
+    if ( nSizeC == 0 )
+        return 1;
+    for ( i = k = 0; i < nSizeB; i++ )
+    {
+        if ( pBase[i] > pCut[k] )
+            return 0;
+        if ( pBase[i] == pCut[k] )
+        {
+            if ( ++k == nSizeC )
+                return 1;
+        }
+    }
+    return 0;
+}
+static inline int Gia_CutIsContainedOrder( int * pBase, int nSizeB, int * pCut, int nSizeC )
+{
+#ifdef GIA_CUT_SSE
+    if ( nSizeB <= GIA_CUT_LOAD )
+    {
+        __m128i BLo = _mm_loadu_si128( (__m128i *)pBase ), BHi = _mm_loadu_si128( (__m128i *)(pBase + 4) );
+        unsigned MaskB = (1 << nSizeB) - 1;
+        int k;
+        assert( nSizeB >= nSizeC );
+        for ( k = 0; k < nSizeC; k++ )
+        {
+            __m128i Leaf = _mm_set1_epi32( pCut[k] );
+            if ( !(Gia_CutVecMask(_mm_cmpeq_epi32(BLo, Leaf), _mm_cmpeq_epi32(BHi, Leaf)) & MaskB) )
+                return 0;
+        }
+        return 1;
+    }
+#endif
+    return Gia_CutIsContainedOrderScalar( pBase, nSizeB, pCut, nSizeC );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
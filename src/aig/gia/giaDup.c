@@ -59,7 +59,7 @@ void Gia_ManDupRemapLiterals( Vec_Int_t * vLits, Gia_Man_t * p )
         if ( ~pObj->Value == 0 )
             iLitNew = -1;
         else
-            iLitNew = Abc_LitNotCond( pObj->Value, Abc_LitIsCompl(iLit) );
+            iLitNew = Gia_LitNotCond( pObj->Value, Gia_LitIsCompl(iLit) );
         Vec_IntWriteEntry( vLits, i, iLitNew );
     }
 }
@@ -88,7 +88,7 @@ void Gia_ManDupRemapEquiv( Gia_Man_t * pNew, Gia_Man_t * p )
         Gia_ObjSetRepr( pNew, i, GIA_VOID );
     // iterate over constant candidates
     Gia_ManForEachConst( p, i )
-        Gia_ObjSetRepr( pNew, Abc_Lit2Var(Gia_ManObj(p, i)->Value), 0 );
+        Gia_ObjSetRepr( pNew, Gia_Lit2Var(Gia_ManObj(p, i)->Value), 0 );
     // iterate over class candidates
     vClass = Vec_IntAlloc( 100 );
     Gia_ManForEachClass( p, i )
@@ -173,7 +173,7 @@ void Gia_ManDupRemapCos( Gia_Man_t * pNew, Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManDupOrderDfs_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+Gia_Lit_t Gia_ManDupOrderDfs_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
     if ( ~pObj->Value )
         return pObj->Value;
@@ -415,8 +415,8 @@ void Gia_ManDupOrderDfsChoices_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t *
     pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
     if ( pNext )
     {
-        pNew->pNexts[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var( Abc_Lit2Var(pNext->Value) );
-        assert( Abc_Lit2Var(pObj->Value) > Abc_Lit2Var(pNext->Value) );
+        pNew->pNexts[Gia_Lit2Var(pObj->Value)] = Gia_Lit2Var( Gia_Lit2Var(pNext->Value) );
+        assert( Gia_Lit2Var(pObj->Value) > Gia_Lit2Var(pNext->Value) );
     }
 } 
 
@@ -466,7 +466,7 @@ Gia_Man_t * Gia_ManDupOrderDfsChoices( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManDupOrderDfs2_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+Gia_Lit_t Gia_ManDupOrderDfs2_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
     if ( ~pObj->Value )
         return pObj->Value;
@@ -573,7 +573,7 @@ Gia_Man_t * Gia_ManDupOnsetOffset( Gia_Man_t * p )
     Gia_ManForEachCo( p, pObj, i )
     {
         pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
-        pObj->Value = Gia_ManAppendCo( pNew, Abc_LitNot(Gia_ObjFanin0Copy(pObj)) );
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_LitNot(Gia_ObjFanin0Copy(pObj)) );
     }
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     return pNew;
@@ -638,13 +638,13 @@ Gia_Man_t * Gia_ManDupFlip( Gia_Man_t * p, int * pInitState )
         {
             pObj->Value = Gia_ManAppendCi( pNew );
             if ( Gia_ObjCioId(pObj) >= Gia_ManPiNum(p) )
-                pObj->Value = Abc_LitNotCond( pObj->Value, Abc_InfoHasBit((unsigned *)pInitState, Gia_ObjCioId(pObj) - Gia_ManPiNum(p)) );
+                pObj->Value = Gia_LitNotCond( pObj->Value, Abc_InfoHasBit((unsigned *)pInitState, Gia_ObjCioId(pObj) - Gia_ManPiNum(p)) );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             pObj->Value = Gia_ObjFanin0Copy(pObj);
             if ( Gia_ObjCioId(pObj) >= Gia_ManPoNum(p) )
-                pObj->Value = Abc_LitNotCond( pObj->Value, Abc_InfoHasBit((unsigned *)pInitState, Gia_ObjCioId(pObj) - Gia_ManPoNum(p)) );
+                pObj->Value = Gia_LitNotCond( pObj->Value, Abc_InfoHasBit((unsigned *)pInitState, Gia_ObjCioId(pObj) - Gia_ManPoNum(p)) );
             pObj->Value = Gia_ManAppendCo( pNew, pObj->Value );
         }
     }
@@ -732,7 +732,7 @@ Gia_Man_t * Gia_ManDup( Gia_Man_t * p )
         {
             pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
             if ( Gia_ObjSibl(p, Gia_ObjId(p, pObj)) )
-                pNew->pSibls[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var(Gia_ObjSiblObj(p, Gia_ObjId(p, pObj))->Value);  
+                pNew->pSibls[Gia_Lit2Var(pObj->Value)] = Gia_Lit2Var(Gia_ObjSiblObj(p, Gia_ObjId(p, pObj))->Value);  
         }
         else if ( Gia_ObjIsCi(pObj) )
             pObj->Value = Gia_ManAppendCi( pNew );
@@ -1131,7 +1131,7 @@ void Gia_ManDupAppend( Gia_Man_t * pNew, Gia_Man_t * pTwo )
     int i;
     if ( pNew->nRegs > 0 )
         pNew->nRegs = 0;
-    if ( Vec_IntSize(&pNew->vHTable) == 0 )
+    if ( pNew->nHTable == 0 )
         Gia_ManHashStart( pNew );
     Gia_ManConst0(pTwo)->Value = 0;
     Gia_ManForEachObj1( pTwo, pObj, i )
@@ -1149,7 +1149,7 @@ void Gia_ManDupAppendShare( Gia_Man_t * pNew, Gia_Man_t * pTwo )
     Gia_Obj_t * pObj;
     int i;
     assert( Gia_ManCiNum(pNew) == Gia_ManCiNum(pTwo) );
-    if ( Vec_IntSize(&pNew->vHTable) == 0 )
+    if ( pNew->nHTable == 0 )
         Gia_ManHashStart( pNew );
     Gia_ManConst0(pTwo)->Value = 0;
     Gia_ManForEachObj1( pTwo, pObj, i )
@@ -1498,8 +1498,8 @@ Gia_Man_t * Gia_ManDupMarked( Gia_Man_t * p )
             if ( !~pRepr->Value )
                 continue;
             assert( !Gia_ObjIsBuf(pObj) );
-            if ( Abc_Lit2Var(pObj->Value) != Abc_Lit2Var(pRepr->Value) )
-                Gia_ObjSetRepr( pNew, Abc_Lit2Var(pObj->Value), Abc_Lit2Var(pRepr->Value) ); 
+            if ( Gia_Lit2Var(pObj->Value) != Gia_Lit2Var(pRepr->Value) )
+                Gia_ObjSetRepr( pNew, Gia_Lit2Var(pObj->Value), Gia_Lit2Var(pRepr->Value) ); 
         }
         pNew->pNexts = Gia_ManDeriveNexts( pNew );
     }
@@ -1517,8 +1517,8 @@ Gia_Man_t * Gia_ManDupMarked( Gia_Man_t * p )
             if ( !~pSibl->Value )
                 continue;
             assert( !Gia_ObjIsBuf(pObj) );
-            assert( Abc_Lit2Var(pObj->Value) > Abc_Lit2Var(pSibl->Value) );
-            pNew->pSibls[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var(pSibl->Value);
+            assert( Gia_Lit2Var(pObj->Value) > Gia_Lit2Var(pSibl->Value) );
+            pNew->pSibls[Gia_Lit2Var(pObj->Value)] = Gia_Lit2Var(pSibl->Value);
         }
     }
     return pNew;
@@ -1615,7 +1615,7 @@ Gia_Man_t * Gia_ManDupTimes( Gia_Man_t * p, int nTimes )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManDupDfs2_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+Gia_Lit_t Gia_ManDupDfs2_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
     if ( ~pObj->Value )
         return pObj->Value;
@@ -1623,7 +1623,7 @@ int Gia_ManDupDfs2_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
     {
         Gia_Obj_t * pRepr = Gia_ManObj( p, p->pReprsOld[Gia_ObjId(p, pObj)] );
         pRepr->Value = Gia_ManDupDfs2_rec( pNew, p, pRepr );
-        return pObj->Value = Abc_LitNotCond( pRepr->Value, Gia_ObjPhaseReal(pRepr) ^ Gia_ObjPhaseReal(pObj) );
+        return pObj->Value = Gia_LitNotCond( pRepr->Value, Gia_ObjPhaseReal(pRepr) ^ Gia_ObjPhaseReal(pObj) );
     }
     if ( Gia_ObjIsCi(pObj) )
         return pObj->Value = Gia_ManAppendCi(pNew);
@@ -1631,7 +1631,7 @@ int Gia_ManDupDfs2_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
     if ( Gia_ObjIsCo(pObj) )
         return pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
     Gia_ManDupDfs2_rec( pNew, p, Gia_ObjFanin1(pObj) );
-    if ( Vec_IntSize(&pNew->vHTable) )
+    if ( pNew->nHTable )
         return pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
     return pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
 } 
@@ -2909,7 +2909,7 @@ Gia_Man_t * Gia_ManDupTopAnd( Gia_Man_t * p, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManMiter_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+Gia_Lit_t Gia_ManMiter_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
     if ( ~pObj->Value )
         return pObj->Value;
@@ -3511,7 +3511,7 @@ Gia_Man_t * Gia_ManDupZeroUndc( Gia_Man_t * p, char * pInit, int nNewPis, int fG
     Gia_ManForEachRo( p, pObj, i )
     {
         if ( pInit[i] == '1' )
-            pObj->Value = Abc_LitNot(pObj->Value), Count1++;
+            pObj->Value = Gia_LitNot(pObj->Value), Count1++;
         else if ( pInit[i] == 'x' || pInit[i] == 'X' )
         {
             if ( pObj->fMark0 ) // only add MUX if the flop has fanout
@@ -3531,7 +3531,7 @@ Gia_Man_t * Gia_ManDupZeroUndc( Gia_Man_t * p, char * pInit, int nNewPis, int fG
     // create flop inputs
     Gia_ManForEachRi( p, pObj, i )
         if ( pInit[i] == '1' )
-            pObj->Value = Gia_ManAppendCo( pNew, Abc_LitNot(Gia_ObjFanin0Copy(pObj)) );
+            pObj->Value = Gia_ManAppendCo( pNew, Gia_LitNot(Gia_ObjFanin0Copy(pObj)) );
         else
             pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
     // create reset flop input
@@ -3644,7 +3644,7 @@ Gia_Man_t * Gia_ManMiter2( Gia_Man_t * pStart, char * pInit, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManChoiceMiter_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+Gia_Lit_t Gia_ManChoiceMiter_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
     if ( ~pObj->Value )
         return pObj->Value;
@@ -4396,7 +4396,7 @@ Vec_Int_t * Gia_ManSortCoBySuppSize( Gia_Man_t * p, Vec_Wec_t * vSupps )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManDupHashDfs_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+Gia_Lit_t Gia_ManDupHashDfs_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
 {
     if ( ~pObj->Value )
         return pObj->Value;
@@ -4891,7 +4891,7 @@ Gia_Man_t * Gia_ManDemiterToDual( Gia_Man_t * p )
     {
         Gia_ManSetPhase( p );
         Gia_ManForEachObjVec( vOrder, p, pObj, i )
-            Gia_ManAppendCo( pNew, Abc_LitNotCond(pObj->Value, pObj->fPhase) );
+            Gia_ManAppendCo( pNew, Gia_LitNotCond(pObj->Value, pObj->fPhase) );
     }
     Vec_IntFree( vNodes );
     Vec_IntFree( vOrder );
@@ -5179,7 +5179,7 @@ void Gia_ManSeqEquivDivide( Gia_Man_t * p, Cec_ParCor_t * pPars )
         // make the nodes of the part AIG point to their prototypes in the AIG
         Gia_ManForEachObj( p, pObj, i )
             if ( ~pObj->Value )
-                Gia_ManObj( pParts[n], Abc_Lit2Var(pObj->Value) )->Value = i;
+                Gia_ManObj( pParts[n], Gia_Lit2Var(pObj->Value) )->Value = i;
     }
     Gia_ManSeqEquivMerge( p, pParts );
     Gia_ManStop( pParts[0] );
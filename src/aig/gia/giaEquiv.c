@@ -2019,6 +2019,65 @@ Gia_Man_t * Gia_ManEquivToChoices( Gia_Man_t * p, int nSnapshots )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Transforms choices given by equivalence classes into siblings.]
+
+  Description [Takes the AIG with choices derived by Gia_ManEquivToChoices,
+  in which the choice nodes of each class are linked through the next
+  pointers, and returns the AIG with the same choices represented by the
+  sibling pointers, as expected by the mappers. Similar to converting the
+  AIG into Aig_Man_t with choices and back, but without building the 
+  intermediate manager. The members of each class are added before the 
+  representative, so that the sibling has a smaller ID than the node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManEquivToSibls_rec( Gia_Man_t * pNew, Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int iNext;
+    if ( ~pObj->Value )
+        return pObj->Value;
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFaninId0(pObj, iObj) );
+    Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFaninId1(pObj, iObj) );
+    iNext = Gia_ObjNext( p, iObj );
+    if ( iNext > 0 )
+        Gia_ManEquivToSibls_rec( pNew, p, iNext );
+    pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    if ( iNext > 0 )
+    {
+        assert( Abc_Lit2Var(pObj->Value) > Abc_Lit2Var(Gia_ManObj(p, iNext)->Value) );
+        pNew->pSibls[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var(Gia_ManObj(p, iNext)->Value);
+    }
+    return pObj->Value;
+}
+Gia_Man_t * Gia_ManEquivToSibls( Gia_Man_t * p )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->pReprs && p->pNexts );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFaninId0p(p, pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Counts the number of choice nodes]
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -33,38 +34,58 @@ ABC_NAMESPACE_IMPL_START
 
 /**Function*************************************************************
 
-  Synopsis    [Returns the place where this node is stored (or should be stored).]
+  Synopsis    [Returns the slot where this node is stored (or should be stored).]
 
-  Description []
+  Description [The table is open-addressed with linear probing. Each slot
+  takes GIA_HASH_SLOT literals: the two fanin literals followed by the
+  object ID (zero for an empty slot). Keeping the key inline means that
+  probing does not touch the object array, except for MUXes, whose control
+  literal is compared through the object. The table size is a power of two
+  and the load factor is kept below one half. Slots are indexed with 64-bit 
+  integers, so the table can grow to twice the limit on the number of 
+  objects, and the load factor bound holds for any AIG.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+#define GIA_HASH_LOG_MAX (GIA_OBJ_LOG + 1)
+
+static inline word Gia_ManHashOne( Gia_Lit_t iLit0, Gia_Lit_t iLit1, Gia_Lit_t iLitC, word Mask ) 
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    word Key = ((word)(unsigned)iLit1 << 32) | (unsigned)iLit0;
+    Key ^= (word)(unsigned)(iLitC + 1) * ABC_CONST(0xC2B2AE3D27D4EB4F);
+    return ((Key * ABC_CONST(0x9E3779B97F4A7C15)) >> 32) & Mask;
 }
-static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+static inline Gia_Lit_t * Gia_ManHashSlot( Gia_Man_t * p, word i )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    return p->pHTable + GIA_HASH_SLOT * i;
+}
+static inline int Gia_ManHashIsFull( Gia_Man_t * p )
+{
+    return (word)Gia_ManAndNum(p) >= p->nHTable / 2;
+}
+static inline Gia_Lit_t * Gia_ManHashFind( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1, Gia_Lit_t iLitC )
+{
+    word Mask = p->nHTable - 1;
+    word i = Gia_ManHashOne( iLit0, iLit1, iLitC, Mask );
+    Gia_Lit_t * pSlot = Gia_ManHashSlot( p, i );
+    assert( (Mask & (Mask + 1)) == 0 );
     assert( p->pMuxes || iLit0 < iLit1 );
-    assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
-    assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
-    {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
-        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
+    assert( iLit0 < iLit1 || (!Gia_LitIsCompl(iLit0) && !Gia_LitIsCompl(iLit1)) );
+    assert( iLitC == -1 || !Gia_LitIsCompl(iLit1) );
+    for ( ; pSlot[2]; i = (i + 1) & Mask, pSlot = Gia_ManHashSlot(p, i) )
+        if ( pSlot[0] == iLit0 && pSlot[1] == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, (int)pSlot[2]) == iLitC) )
             break;
-    }
-    return pPlace;
+    return pSlot;
+}
+static inline void Gia_ManHashInsert( Gia_Lit_t * pSlot, Gia_Lit_t iLit0, Gia_Lit_t iLit1, int iObj )
+{
+    assert( pSlot[2] == 0 && iObj > 0 );
+    pSlot[0] = iLit0;
+    pSlot[1] = iLit1;
+    pSlot[2] = iObj;
 }
 
 /**Function*************************************************************
@@ -78,16 +99,16 @@ static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iL
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 )
+Gia_Lit_t Gia_ManHashLookupInt( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )
 {
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
-    return Abc_Var2Lit( *Gia_ManHashFind( p, iLit0, iLit1, -1 ), 0 );
+    return Gia_Var2Lit( (int)Gia_ManHashFind( p, iLit0, iLit1, -1 )[2], 0 );
 }
-int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
+Gia_Lit_t Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 {
-    int iLit0 = Gia_ObjToLit( p, p0 );
-    int iLit1 = Gia_ObjToLit( p, p1 );
+    Gia_Lit_t iLit0 = Gia_ObjToLit( p, p0 );
+    Gia_Lit_t iLit1 = Gia_ObjToLit( p, p1 );
     return Gia_ManHashLookupInt( p, iLit0, iLit1 );
 }
 
@@ -104,11 +125,11 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
-    assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    int nEntries = Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc;
+    int nSlotsLog = Abc_MinInt( GIA_HASH_LOG_MAX, Abc_MaxInt( 10, Abc_Base2Log(2 * (unsigned)nEntries + 1) ) );
+    assert( p->pHTable == NULL );
+    p->nHTable = (word)1 << nSlotsLog;
+    p->pHTable = ABC_CALLOC( Gia_Lit_t, GIA_HASH_SLOT * p->nHTable );
 }
 
 /**Function*************************************************************
@@ -125,13 +146,12 @@ void Gia_ManHashAlloc( Gia_Man_t * p )
 void Gia_ManHashStart( Gia_Man_t * p )  
 {
     Gia_Obj_t * pObj;
-    int * pPlace, i;
+    int i;
     Gia_ManHashAlloc( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
-        pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
-        assert( *pPlace == 0 );
-        *pPlace = i;
+        Gia_Lit_t * pSlot = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
+        Gia_ManHashInsert( pSlot, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), i );
     }
 }
 
@@ -148,15 +168,16 @@ void Gia_ManHashStart( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
-    Vec_IntErase( &p->vHTable );
-    Vec_IntErase( &p->vHash );
+    ABC_FREE( p->pHTable );
+    p->nHTable = 0;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [Doubles the number of slots and reinserts the entries
+  using the keys stored in the old table.]
                
   SideEffects []
 
@@ -165,39 +186,33 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
+    Gia_Lit_t * pSlot, * pOld, * pTableOld = p->pHTable;
+    int Counter = 0;
+    word i, nSlotsOld = p->nHTable;
+    assert( nSlotsOld > 0 );
+    assert( 2 * nSlotsOld <= ((word)1 << GIA_HASH_LOG_MAX) );
     // replace the table
-    Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
+    p->nHTable = 2 * nSlotsOld;
+    p->pHTable = ABC_CALLOC( Gia_Lit_t, GIA_HASH_SLOT * p->nHTable );
     // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
-//    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+    for ( i = 0; i < nSlotsOld; i++ )
+    {
+        pOld = pTableOld + GIA_HASH_SLOT * i;
+        if ( pOld[2] == 0 )
+            continue;
+        pSlot = Gia_ManHashFind( p, pOld[0], pOld[1], p->pMuxes ? Gia_ObjFaninLit2(p, (int)pOld[2]) : -1 );
+        Gia_ManHashInsert( pSlot, pOld[0], pOld[1], (int)pOld[2] );
+        Counter++;
+    }
+    assert( Counter <= Gia_ManAndNum(p) - Gia_ManBufNum(p) );
+    ABC_FREE( pTableOld );
 }
 
 /**Function********************************************************************
 
   Synopsis    [Profiles the hash table.]
 
-  Description []
+  Description [Prints the histogram of probe lengths of the stored entries.]
 
   SideEffects []
 
@@ -206,21 +221,29 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
-    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    int Counts[17] = {0};
+    word i, k, Mask = p->nHTable - 1;
+    int Entries = 0, MaxDist = 0;
+    double Total = 0;
+    for ( i = 0; i <= Mask; i++ )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        Gia_Lit_t * pSlot = Gia_ManHashSlot( p, i );
+        int Dist;
+        if ( pSlot[2] == 0 )
+            continue;
+        k = Gia_ManHashOne( pSlot[0], pSlot[1], p->pMuxes ? Gia_ObjFaninLit2(p, (int)pSlot[2]) : -1, Mask );
+        Dist = (int)((i - k) & Mask);
+        Counts[Abc_MinInt(Dist, 16)]++;
+        MaxDist = Abc_MaxInt( MaxDist, Dist );
+        Total += Dist + 1;
+        Entries++;
     }
+    printf( "Table size = %.0f. Entries = %d. Load = %.2f. ", (double)(Mask + 1), Entries, 1.0 * Entries / (Mask + 1) );
+    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
+    printf( "Average probes = %.2f. Max distance = %d. Distances: ", Entries ? Total / Entries : 0.0, MaxDist );
+    for ( i = 0; i < 17; i++ )
+        if ( Counts[i] ) 
+            printf( "%s%d=%d ", i == 16 ? ">=" : "", (int)i, Counts[i] );
     printf( "\n" );
 }
 
@@ -466,44 +489,36 @@ static inline Gia_Obj_t * Gia_ManAddStrash( Gia_Man_t * p, Gia_Obj_t * p0, Gia_O
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )  
+Gia_Lit_t Gia_ManHashXorReal( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     int fCompl = 0;
     assert( p->fAddStrash == 0 );
     if ( iLit0 < 2 )
-        return iLit0 ? Abc_LitNot(iLit1) : iLit1;
+        return iLit0 ? Gia_LitNot(iLit1) : iLit1;
     if ( iLit1 < 2 )
-        return iLit1 ? Abc_LitNot(iLit0) : iLit0;
+        return iLit1 ? Gia_LitNot(iLit0) : iLit0;
     if ( iLit0 == iLit1 )
         return 0;
-    if ( iLit0 == Abc_LitNot(iLit1) )
+    if ( iLit0 == Gia_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( Gia_ManHashIsFull(p) )
         Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
-    if ( Abc_LitIsCompl(iLit0) )
-        iLit0 = Abc_LitNot(iLit0), fCompl ^= 1;
-    if ( Abc_LitIsCompl(iLit1) )
-        iLit1 = Abc_LitNot(iLit1), fCompl ^= 1;
+    if ( Gia_LitIsCompl(iLit0) )
+        iLit0 = Gia_LitNot(iLit0), fCompl ^= 1;
+    if ( Gia_LitIsCompl(iLit1) )
+        iLit1 = Gia_LitNot(iLit1), fCompl ^= 1;
     {
-        int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace )
+        Gia_Lit_t * pSlot = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( pSlot[2] )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, fCompl );
+            return Gia_Var2Lit( (int)pSlot[2], fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, fCompl );
+        Gia_ManHashInsert( pSlot, iLit0, iLit1, Gia_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) ) );
+        return Gia_Var2Lit( (int)pSlot[2], fCompl );
     }
 }
 
@@ -518,47 +533,39 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )  
+Gia_Lit_t Gia_ManHashMuxReal( Gia_Man_t * p, Gia_Lit_t iLitC, Gia_Lit_t iLit1, Gia_Lit_t iLit0 )  
 {
     int fCompl = 0;
     assert( p->fAddStrash == 0 );
     if ( iLitC < 2 )
         return iLitC ? iLit1 : iLit0;
     if ( iLit0 < 2 )
-        return iLit0 ? Gia_ManHashOr(p, Abc_LitNot(iLitC), iLit1) : Gia_ManHashAnd(p, iLitC, iLit1);
+        return iLit0 ? Gia_ManHashOr(p, Gia_LitNot(iLitC), iLit1) : Gia_ManHashAnd(p, iLitC, iLit1);
     if ( iLit1 < 2 )
-        return iLit1 ? Gia_ManHashOr(p, iLitC, iLit0) : Gia_ManHashAnd(p, Abc_LitNot(iLitC), iLit0);
+        return iLit1 ? Gia_ManHashOr(p, iLitC, iLit0) : Gia_ManHashAnd(p, Gia_LitNot(iLitC), iLit0);
     assert( iLit0 > 1 && iLit1 > 1 && iLitC > 1 );
     if ( iLit0 == iLit1 )
         return iLit0;
-    if ( iLitC == iLit0 || iLitC == Abc_LitNot(iLit1) )
+    if ( iLitC == iLit0 || iLitC == Gia_LitNot(iLit1) )
         return Gia_ManHashAnd(p, iLit0, iLit1);
-    if ( iLitC == iLit1 || iLitC == Abc_LitNot(iLit0) )
+    if ( iLitC == iLit1 || iLitC == Gia_LitNot(iLit0) )
         return Gia_ManHashOr(p, iLit0, iLit1);
-    if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) )
+    if ( Gia_Lit2Var(iLit0) == Gia_Lit2Var(iLit1) )
         return Gia_ManHashXorReal( p, iLitC, iLit0 );
     if ( iLit0 > iLit1 )
-        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
-    if ( Abc_LitIsCompl(iLit1) )
-        iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Gia_LitNot(iLitC);
+    if ( Gia_LitIsCompl(iLit1) )
+        iLit0 = Gia_LitNot(iLit0), iLit1 = Gia_LitNot(iLit1), fCompl = 1;
     {
-        int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-        if ( *pPlace )
+        Gia_Lit_t * pSlot = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
+        if ( pSlot[2] )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, fCompl );
+            return Gia_Var2Lit( (int)pSlot[2], fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, fCompl );
+        Gia_ManHashInsert( pSlot, iLit0, iLit1, Gia_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) ) );
+        return Gia_Var2Lit( (int)pSlot[2], fCompl );
     }
 }
 
@@ -573,7 +580,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )  
+Gia_Lit_t Gia_ManHashAnd( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     if ( iLit0 < 2 )
         return iLit0 ? iLit1 : 0;
@@ -581,14 +588,14 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         return iLit1 ? iLit0 : 0;
     if ( iLit0 == iLit1 )
         return iLit1;
-    if ( iLit0 == Abc_LitNot(iLit1) )
+    if ( iLit0 == Gia_LitNot(iLit1) )
         return 0;
     if ( p->fGiaSimple )
     {
-        assert( Vec_IntSize(&p->vHTable) == 0 );
+        assert( p->pHTable == NULL );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( Gia_ManHashIsFull(p) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
@@ -599,28 +606,20 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     {
-        int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace )
+        Gia_Lit_t * pSlot = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( pSlot[2] )
         {
             p->nHashHit++;
-            return Abc_Var2Lit( *pPlace, 0 );
+            return Gia_Var2Lit( (int)pSlot[2], 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
-        return Abc_Var2Lit( *pPlace, 0 );
+        Gia_ManHashInsert( pSlot, iLit0, iLit1, Gia_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) ) );
+        return Gia_Var2Lit( (int)pSlot[2], 0 );
     }
 }
-int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )  
+Gia_Lit_t Gia_ManHashOr( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
-    return Abc_LitNot(Gia_ManHashAnd( p, Abc_LitNot(iLit0), Abc_LitNot(iLit1) ));
+    return Gia_LitNot(Gia_ManHashAnd( p, Gia_LitNot(iLit0), Gia_LitNot(iLit1) ));
 }
 
 /**Function*************************************************************
@@ -634,7 +633,7 @@ int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )  
+Gia_Lit_t Gia_ManHashAndTry( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     if ( iLit0 < 2 )
         return iLit0 ? iLit1 : 0;
@@ -642,14 +641,14 @@ int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )
         return iLit1 ? iLit0 : 0;
     if ( iLit0 == iLit1 )
         return iLit1;
-    if ( iLit0 == Abc_LitNot(iLit1) )
+    if ( iLit0 == Gia_LitNot(iLit1) )
         return 0;
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     {
-        int * pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-        if ( *pPlace ) 
-            return Abc_Var2Lit( *pPlace, 0 );
+        Gia_Lit_t * pSlot = Gia_ManHashFind( p, iLit0, iLit1, -1 );
+        if ( pSlot[2] ) 
+            return Gia_Var2Lit( (int)pSlot[2], 0 );
         return -1;
     }
 }
@@ -665,16 +664,16 @@ int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashXor( Gia_Man_t * p, int iLit0, int iLit1 )  
+Gia_Lit_t Gia_ManHashXor( Gia_Man_t * p, Gia_Lit_t iLit0, Gia_Lit_t iLit1 )  
 { 
     if ( p->fGiaSimple )
-        return Gia_ManHashOr(p, Gia_ManHashAnd(p, iLit0, Abc_LitNot(iLit1)), Gia_ManHashAnd(p, Abc_LitNot(iLit0), iLit1) );
+        return Gia_ManHashOr(p, Gia_ManHashAnd(p, iLit0, Gia_LitNot(iLit1)), Gia_ManHashAnd(p, Gia_LitNot(iLit0), iLit1) );
     else
     {
-        int fCompl = Abc_LitIsCompl(iLit0) ^ Abc_LitIsCompl(iLit1);
-        int iTemp0 = Gia_ManHashAnd( p, Abc_LitRegular(iLit0), Abc_LitNot(Abc_LitRegular(iLit1)) );
-        int iTemp1 = Gia_ManHashAnd( p, Abc_LitRegular(iLit1), Abc_LitNot(Abc_LitRegular(iLit0)) );
-        return Abc_LitNotCond( Gia_ManHashAnd( p, Abc_LitNot(iTemp0), Abc_LitNot(iTemp1) ), !fCompl );
+        int fCompl = Gia_LitIsCompl(iLit0) ^ Gia_LitIsCompl(iLit1);
+        Gia_Lit_t iTemp0 = Gia_ManHashAnd( p, Gia_LitRegular(iLit0), Gia_LitNot(Gia_LitRegular(iLit1)) );
+        Gia_Lit_t iTemp1 = Gia_ManHashAnd( p, Gia_LitRegular(iLit1), Gia_LitNot(Gia_LitRegular(iLit0)) );
+        return Gia_LitNotCond( Gia_ManHashAnd( p, Gia_LitNot(iTemp0), Gia_LitNot(iTemp1) ), !fCompl );
     }
 }
 
@@ -689,20 +688,21 @@ int Gia_ManHashXor( Gia_Man_t * p, int iLit0, int iLit1 )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 )  
+Gia_Lit_t Gia_ManHashMux( Gia_Man_t * p, Gia_Lit_t iCtrl, Gia_Lit_t iData1, Gia_Lit_t iData0 )  
 { 
     if ( p->fGiaSimple )
-        return Gia_ManHashOr(p, Gia_ManHashAnd(p, iCtrl, iData1), Gia_ManHashAnd(p, Abc_LitNot(iCtrl), iData0) );
+        return Gia_ManHashOr(p, Gia_ManHashAnd(p, iCtrl, iData1), Gia_ManHashAnd(p, Gia_LitNot(iCtrl), iData0) );
     else
     {
-        int iTemp0, iTemp1, fCompl = 0;
+        Gia_Lit_t iTemp0, iTemp1;
+        int fCompl = 0;
         if ( iData0 > iData1 )
-            iData0 ^= iData1, iData1 ^= iData0, iData0 ^= iData1, iCtrl = Abc_LitNot(iCtrl);
-        if ( Abc_LitIsCompl(iData1) )
-            iData0 = Abc_LitNot(iData0), iData1 = Abc_LitNot(iData1), fCompl = 1;
-        iTemp0 = Gia_ManHashAnd( p, Abc_LitNot(iCtrl), iData0 );
+            iData0 ^= iData1, iData1 ^= iData0, iData0 ^= iData1, iCtrl = Gia_LitNot(iCtrl);
+        if ( Gia_LitIsCompl(iData1) )
+            iData0 = Gia_LitNot(iData0), iData1 = Gia_LitNot(iData1), fCompl = 1;
+        iTemp0 = Gia_ManHashAnd( p, Gia_LitNot(iCtrl), iData0 );
         iTemp1 = Gia_ManHashAnd( p, iCtrl, iData1 );
-        return Abc_LitNotCond( Gia_ManHashAnd( p, Abc_LitNot(iTemp0), Abc_LitNot(iTemp1) ), !fCompl );
+        return Gia_LitNotCond( Gia_ManHashAnd( p, Gia_LitNot(iTemp0), Gia_LitNot(iTemp1) ), !fCompl );
     }
 }
 
@@ -717,11 +717,11 @@ int Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 )
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 )  
+Gia_Lit_t Gia_ManHashMaj( Gia_Man_t * p, Gia_Lit_t iData0, Gia_Lit_t iData1, Gia_Lit_t iData2 )  
 { 
-    int iTemp0 = Gia_ManHashOr( p, iData1, iData2 );
-    int iTemp1 = Gia_ManHashAnd( p, iData0, iTemp0 );
-    int iTemp2 = Gia_ManHashAnd( p, iData1, iData2 );
+    Gia_Lit_t iTemp0 = Gia_ManHashOr( p, iData1, iData2 );
+    Gia_Lit_t iTemp1 = Gia_ManHashAnd( p, iData0, iTemp0 );
+    Gia_Lit_t iTemp2 = Gia_ManHashAnd( p, iData1, iData2 );
     return Gia_ManHashOr( p, iTemp1, iTemp2 );
 }
 
@@ -768,6 +768,252 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Chained hash table used before the open-addressing one.]
+
+  Description [Buckets are indexed modulo a prime and collisions are
+  chained through an array indexed by object IDs. The fanins are compared
+  by dereferencing the objects. Kept only for benchmarking.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Gia_ManHashChainFind( Gia_Man_t * p, Vec_Int_t * vTable, Vec_Int_t * vNext, int iLit0, int iLit1 )
+{
+    unsigned Key = Abc_Lit2Var(iLit0) * 7937 + Abc_Lit2Var(iLit1) * 2971 + Abc_LitIsCompl(iLit0) * 911 + Abc_LitIsCompl(iLit1) * 353 - 2011;
+    int iThis, * pPlace = Vec_IntEntryP( vTable, (int)(Key % Vec_IntSize(vTable)) );
+    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(vNext, iThis) )
+    {
+        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
+        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 )
+            break;
+    }
+    return pPlace;
+}
+static inline int Gia_ManHashChainAnd( Gia_Man_t * p, Vec_Int_t * vTable, Vec_Int_t * vNext, int iLit0, int iLit1 )
+{
+    int * pPlace;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    pPlace = Gia_ManHashChainFind( p, vTable, vNext, iLit0, iLit1 );
+    if ( *pPlace == 0 )
+        *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
+    return Abc_Var2Lit( *pPlace, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Strashes the AIG using one of the two hash tables.]
+
+  Description [The first pass builds the AIG (mostly misses), the second 
+  pass strashes the same nodes again (only hits). Returns the number of 
+  AND nodes and sets the runtimes and the table memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManHashBenchOne( Gia_Man_t * p, int fChain, abctime * pTimeBuild, abctime * pTimeLookup, double * pMemory )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vTable = NULL, * vNext = NULL;
+    abctime clk;
+    int i, k, nAnds;
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    if ( fChain )
+    {
+        vTable = Vec_IntStart( Abc_PrimeCudd( pNew->nObjsAlloc ) );
+        vNext  = Vec_IntStart( pNew->nObjsAlloc );
+    }
+    else
+        Gia_ManHashAlloc( pNew );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    for ( k = 0; k < 2; k++ )
+    {
+        clk = Abc_Clock();
+        if ( fChain )
+            Gia_ManForEachAnd( p, pObj, i )
+                pObj->Value = Gia_ManHashChainAnd( pNew, vTable, vNext, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        else
+            Gia_ManForEachAnd( p, pObj, i )
+                pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        *(k ? pTimeLookup : pTimeBuild) += Abc_Clock() - clk;
+    }
+    if ( fChain )
+        *pMemory = 4.0 * (Vec_IntSize(vTable) + Vec_IntSize(vNext));
+    else
+        *pMemory = (double)sizeof(Gia_Lit_t) * GIA_HASH_SLOT * (double)pNew->nHTable;
+    nAnds = Gia_ManAndNum( pNew );
+    Vec_IntFreeP( &vTable );
+    Vec_IntFreeP( &vNext );
+    Gia_ManStop( pNew );
+    return nAnds;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the chained and the open-addressing hash tables.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashBench( Gia_Man_t * p, int nIters, int fVerbose )
+{
+    abctime clkBuild[2] = {0}, clkLookup[2] = {0};
+    double Memory[2] = {0}, nNodes = 1.0 * nIters * Gia_ManAndNum(p);
+    int i, k, nAnds[2] = {0};
+    char * pNames[2] = { "Open:   ", "Chained:" };
+    assert( p->pMuxes == NULL );
+    for ( i = 0; i < nIters; i++ )
+        for ( k = 0; k < 2; k++ )
+            nAnds[k] = Gia_ManHashBenchOne( p, k, clkBuild + k, clkLookup + k, Memory + k );
+    printf( "Objects = %d.  ANDs = %d.  Strashed ANDs = %d.  Iterations = %d.\n", Gia_ManObjNum(p), Gia_ManAndNum(p), nAnds[0], nIters );
+    if ( nAnds[0] != nAnds[1] )
+        printf( "Warning: The two tables produced different AIGs (%d and %d nodes).\n", nAnds[0], nAnds[1] );
+    for ( k = 0; k < 2; k++ )
+    {
+        printf( "%s Mem = %8.2f MB  ", pNames[k], Memory[k] / (1 << 20) );
+        printf( "Build = %8.2f Mnodes/sec  ", clkBuild[k]  ? nNodes / 1000000 / (1.0 * clkBuild[k]  / CLOCKS_PER_SEC) : 0.0 );
+        printf( "Lookup = %8.2f Mnodes/sec  ", clkLookup[k] ? nNodes / 1000000 / (1.0 * clkLookup[k] / CLOCKS_PER_SEC) : 0.0 );
+        ABC_PRT( "Time", clkBuild[k] + clkLookup[k] );
+    }
+    if ( fVerbose )
+    {
+        Gia_Man_t * pNew = Gia_ManRehash( p, 0 );
+        Gia_ManHashStart( pNew );
+        Gia_ManHashProfile( pNew );
+        Gia_ManStop( pNew );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds independent pieces of logic in parallel.]
+
+  Description [Each task is strashed by the callback into its own shard,
+  a small manager with a private hash table, so the threads never share 
+  a table or the object array. The callback creates the CIs of the shard,
+  its logic, and the COs returning the results. The shards are returned
+  in the task order and should be merged using Gia_ManShardAppend().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_ShardMan_t_ Gia_ShardMan_t;
+struct Gia_ShardMan_t_
+{
+    Gia_ShardBuild_t pBuild;
+    void *           pUser;
+    int              fGiaSimple;
+    Vec_Ptr_t *      vShards;
+};
+static void Gia_ManShardBuildOne( void * pArg, int iTask, int iThread )
+{
+    Gia_ShardMan_t * p = (Gia_ShardMan_t *)pArg;
+    Gia_Man_t * pShard = Gia_ManStart( 1000 );
+    pShard->fGiaSimple = p->fGiaSimple;
+    if ( !p->fGiaSimple )
+        Gia_ManHashAlloc( pShard );
+    p->pBuild( pShard, p->pUser, iTask );
+    Gia_ManHashStop( pShard );
+    Vec_PtrWriteEntry( p->vShards, iTask, pShard );
+}
+Vec_Ptr_t * Gia_ManShardBuild( int nTasks, int nThreads, int fGiaSimple, Gia_ShardBuild_t pBuild, void * pUser )
+{
+    Gia_ShardMan_t Man, * p = &Man;
+    p->pBuild     = pBuild;
+    p->pUser      = pUser;
+    p->fGiaSimple = fGiaSimple;
+    p->vShards    = Vec_PtrStart( nTasks );
+    Util_PthRun( nThreads, nTasks, Gia_ManShardBuildOne, p );
+    return p->vShards;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges one shard into the manager.]
+
+  Description [The CIs of the shard are replaced by literals pCiLits of
+  the manager, the AND nodes are strashed into the manager, and the COs
+  of the shard are returned as literals in vCoLits. Merging the shards in
+  a fixed order makes the result independent of thread scheduling.
+  The shard is merged only if the objects of the shard map into distinct 
+  non-constant nodes of the manager. In this case, any test on literals 
+  made while building the shard has the same outcome as it would have had 
+  for the mapped literals, so the manager ends up exactly as if the logic 
+  were built directly in it. Otherwise, the manager is not changed and 0 
+  is returned, and the caller should build the logic directly.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManShardIsInjective( Gia_Man_t * p, Gia_Man_t * pShard, int * pCiLits )
+{
+    Gia_Obj_t * pObj;
+    int i, iLit0, iLit1, iVar, iFresh = Gia_ManObjNum(p);
+    Gia_ManIncrementTravId( p );
+    Gia_ManForEachCi( pShard, pObj, i )
+    {
+        iVar = Abc_Lit2Var( pCiLits[i] );
+        if ( iVar == 0 || Gia_ObjUpdateTravIdCurrentId(p, iVar) )
+            return 0;
+        pObj->Value = pCiLits[i];
+    }
+    Gia_ManForEachAnd( pShard, pObj, i )
+    {
+        iLit0 = Gia_ObjFanin0Copy( pObj );
+        iLit1 = Gia_ObjFanin1Copy( pObj );
+        // nodes with a fresh fanin are fresh; other nodes may already exist
+        if ( p->nHTable == 0 || Abc_Lit2Var(iLit0) >= Gia_ManObjNum(p) || Abc_Lit2Var(iLit1) >= Gia_ManObjNum(p) || 
+             (iVar = Abc_Lit2Var(Gia_ManHashLookupInt(p, iLit0, iLit1))) == 0 )
+            iVar = iFresh++;
+        else if ( Gia_ObjUpdateTravIdCurrentId(p, iVar) )
+            return 0;
+        pObj->Value = Abc_Var2Lit( iVar, 0 );
+    }
+    return 1;
+}
+int Gia_ManShardAppend( Gia_Man_t * p, Gia_Man_t * pShard, int * pCiLits, Vec_Int_t * vCoLits )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    assert( pShard->pMuxes == NULL );
+    Vec_IntClear( vCoLits );
+    Gia_ManConst0(pShard)->Value = 0;
+    if ( !Gia_ManShardIsInjective(p, pShard, pCiLits) )
+        return 0;
+    Gia_ManForEachCi( pShard, pObj, i )
+        pObj->Value = pCiLits[i];
+    Gia_ManForEachAnd( pShard, pObj, i )
+        pObj->Value = Gia_ManHashAnd( p, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( pShard, pObj, i )
+        Vec_IntPush( vCoLits, Gia_ObjFanin0Copy(pObj) );
+    return 1;
+}
+
 
 /**Function*************************************************************
 
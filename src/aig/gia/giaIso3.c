@@ -207,7 +207,7 @@ void Gia_Iso4Test( Gia_Man_t * p )
         Gia_Obj_t * pObj;  int i;
         printf( "Level %d\n", l );
         Gia_ManForEachObjVec( vLevel, p, pObj, i )
-            printf( "Obj = %5d.  Value = %08x.\n", Gia_ObjId(p, pObj), pObj->Value );
+            printf( "Obj = %5d.  Value = %08x.\n", Gia_ObjId(p, pObj), (unsigned)pObj->Value );
     }
     Vec_WecFree( vLevs );
 }
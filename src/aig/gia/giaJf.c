@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "giaCutEnum.h"
 #include "misc/vec/vecSet.h"
 #include "misc/vec/vecMem.h"
 #include "misc/extra/extra.h"
@@ -479,10 +480,7 @@ static inline int Jf_CountBits32( unsigned i )
 }
 static inline int Jf_CountBits( word i )
 {
-    i = i - ((i >> 1) & 0x5555555555555555);
-    i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
-    i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
-    return (i*(0x0101010101010101))>>56;
+    return Gia_CutCountBits( i );
 }
 static inline unsigned Jf_CutGetSign32( int * pCut )
 {
@@ -553,86 +551,14 @@ static inline float Jf_CutFlow( Jf_Man_t * p, int * pCut )
 ***********************************************************************/
 static inline int Jf_CutIsContainedOrder( int * pBase, int * pCut ) // check if pCut is contained pBase
 {
-    int nSizeB = Jf_CutSize(pBase);
-    int nSizeC = Jf_CutSize(pCut);
-    int i, k;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 1; i <= nSizeB; i++ )
-            if ( pBase[i] != pCut[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    for ( i = k = 1; i <= nSizeB; i++ )
-    {
-        if ( pBase[i] > pCut[k] )
-            return 0;
-        if ( pBase[i] == pCut[k] )
-        {
-            if ( k++ == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Gia_CutIsContainedOrder( pBase + 1, Jf_CutSize(pBase), pCut + 1, Jf_CutSize(pCut) );
 }
 static inline int Jf_CutMergeOrder( int * pCut0, int * pCut1, int * pCut, int LutSize )
 { 
-    int nSize0 = Jf_CutSize(pCut0);
-    int nSize1 = Jf_CutSize(pCut1);
-    int * pC0 = pCut0 + 1;
-    int * pC1 = pCut1 + 1;
-    int * pC = pCut + 1;
-    int i, k, c, s;
-    // the case of the largest cut sizes
-    if ( nSize0 == LutSize && nSize1 == LutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )
-                return 0;
-            pC[i] = pC0[i];
-        }
-        pCut[0] = LutSize;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = s = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == LutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > LutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut[0] = c;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > LutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut[0] = c;
+    int nSize = Gia_CutMergeOrder( pCut0 + 1, Jf_CutSize(pCut0), pCut1 + 1, Jf_CutSize(pCut1), pCut + 1, LutSize );
+    if ( nSize < 0 )
+        return 0;
+    pCut[0] = nSize;
     return 1;
 }
 
@@ -1130,11 +1056,13 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
     int        CutNum = p->pPars->nCutNum;
     int        iObj = Gia_ObjId(p->pGia, pObj);
     word       Sign0[JF_CUT_MAX+2]; // signatures of the first cut
-    word       Sign1[JF_CUT_MAX+2]; // signatures of the second cut
+    Gia_CutSoa_t Soa1;              // sizes and signatures of the second cut
+    int *      pCuts1Arr[JF_CUT_MAX+2]; // the second cuts
     Jf_Cut_t   Sto[JF_CUT_MAX+2];   // cut storage
     Jf_Cut_t * pSto[JF_CUT_MAX+2];  // pointers to cut storage
     int *      pCut0, * pCut1, * pCuts0, * pCuts1;
     int        nOldSupp, Config, i, k, c = 0;
+    unsigned   Mask;
     // prepare cuts
     for ( i = 0; i <= CutNum+1; i++ )
         pSto[i] = Sto + i, pSto[i]->Cost = 0, pSto[i]->iFunc = ~0;
@@ -1144,27 +1072,30 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
         Sign0[i] = Jf_CutGetSign( pCut0 );
     // compute signatures
     pCuts1 = Jf_ObjCuts( p, Gia_ObjFaninId1(pObj, iObj) );
+    Gia_CutSoaClear( &Soa1 );
     Jf_ObjForEachCut( pCuts1, pCut1, i )
-        Sign1[i] = Jf_CutGetSign( pCut1 );
+    {
+        pCuts1Arr[i] = pCut1;
+        Gia_CutSoaPush( &Soa1, Jf_CutSize(pCut1), Jf_CutGetSign(pCut1) );
+    }
     // merge cuts
     p->CutCount[0] += pCuts0[0] * pCuts1[0];
     Jf_ObjForEachCut( pCuts0, pCut0, i )
-    Jf_ObjForEachCut( pCuts1, pCut1, k )
+    Gia_CutSoaForEachPair( &Soa1, Jf_CutSize(pCut0), Sign0[i], LutSize, Mask, k )
     {
-        if ( Jf_CountBits(Sign0[i] | Sign1[k]) > LutSize )
-            continue;
+        pCut1 = pCuts1Arr[k];
         p->CutCount[1]++;        
         if ( !p->pPars->fCutMin )
         {
             if ( !Jf_CutMergeOrder(pCut0, pCut1, pSto[c]->pCut, LutSize) )
                 continue;
-            pSto[c]->Sign = Sign0[i] | Sign1[k];
+            pSto[c]->Sign = Sign0[i] | Soa1.pSigns[k];
         }
         else if ( p->pPars->fFuncDsd )
         {
             if ( !(Config = Jf_CutMerge2(pCut0, pCut1, pSto[c]->pCut, LutSize)) )
                 continue;
-            pSto[c]->Sign = Sign0[i] | Sign1[k];
+            pSto[c]->Sign = Sign0[i] | Soa1.pSigns[k];
             nOldSupp = pSto[c]->pCut[0];
             pSto[c]->iFunc = Sdm_ManComputeFunc( p->pDsd, Jf_ObjFunc0(pObj, pCut0), Jf_ObjFunc1(pObj, pCut1), pSto[c]->pCut, Config, 0 );
             if ( pSto[c]->iFunc == -1 )
@@ -1179,7 +1110,7 @@ void Jf_ObjComputeCuts( Jf_Man_t * p, Gia_Obj_t * pObj, int fEdge )
         {
             if ( !Jf_CutMergeOrder(pCut0, pCut1, pSto[c]->pCut, LutSize) )
                 continue;
-            pSto[c]->Sign = Sign0[i] | Sign1[k];
+            pSto[c]->Sign = Sign0[i] | Soa1.pSigns[k];
             nOldSupp = pSto[c]->pCut[0];
             pSto[c]->iFunc = Jf_TtComputeForCut( p, Jf_ObjFunc0(pObj, pCut0), Jf_ObjFunc1(pObj, pCut1), pCut0, pCut1, pSto[c]->pCut );
             assert( pSto[c]->pCut[0] <= nOldSupp );
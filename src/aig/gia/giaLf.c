@@ -19,10 +19,12 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "giaCutEnum.h"
 #include "misc/tim/tim.h"
 #include "misc/vec/vecSet.h"
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -70,9 +72,24 @@ struct Lf_Mem_t_
     int             LogPage;         // log size of memory page
     int             MaskPage;        // page mask
     int             nCutWords;       // cut size in words
-    int             iCur;            // writing position 
+    int             nPages;          // the number of used pages
     Vec_Ptr_t       vPages;          // memory pages
-    Vec_Ptr_t *     vFree;           // free pages 
+    Vec_Ptr_t *     vFree;           // free pages (NULL if not recycled)
+};
+typedef struct Lf_Thr_t_ Lf_Thr_t; 
+struct Lf_Thr_t_
+{
+    int             iCur;            // writing position (-1 if there is no page)
+    Vec_Int_t       vFreeSets;       // free cutsets
+    Vec_Int_t       vFreeNext;       // cutsets freed at the current level
+    word            CutTemp[3][LF_CUT_WORDS]; // unit cuts of the fanins
+    word            CutMux[LF_CUT_WORDS];     // the MUX cut
+    // statistics
+    double          CutCount[4];     // cut counts
+    int             nFrontMax;       // frontier
+    int             nTimeFails;      // timing fails
+    int             nCutEqual;       // equal two cuts
+    int             nCutCounts[LF_LEAF_MAX+1];
 };
 typedef struct Lf_Man_t_ Lf_Man_t; 
 struct Lf_Man_t_
@@ -85,7 +102,7 @@ struct Lf_Man_t_
     int             nSetWords;       // set size in words
     Lf_Bst_t *      pObjBests;       // best cuts
     Vec_Ptr_t       vMemSets;        // memory for cutsets
-    Vec_Int_t       vFreeSets;       // free cutsets
+    int             nMemSets;        // the number of used cutset pages
     Vec_Mem_t *     vTtMem;          // truth tables
     Vec_Ptr_t       vFreePages;      // free memory pages
     Lf_Mem_t        vStoreOld;       // previous cuts
@@ -98,6 +115,12 @@ struct Lf_Man_t_
     Vec_Int_t       vMapRefs;        // mapping refs
     Vec_Flt_t       vSwitches;       // switching activity
     Vec_Int_t       vCiArrivals;     // arrival times of the CIs
+    // threads
+    Lf_Thr_t *      pThrs;           // per-thread cut computation data
+    int             nThreads;        // the number of threads
+    int             fParallel;       // the nodes of one level are processed concurrently
+    Vec_Int_t       vFreePool;       // cutsets freed at the completed levels
+    int             nFreePool;       // the number of cutsets left in the pool
     // statistics
     abctime         clkStart;        // starting time
     double          CutCount[4];     // cut counts
@@ -361,7 +384,7 @@ static inline int Lf_CutCreateUnit( Lf_Cut_t * p, int i )
     p->Sign = ((word)1) << (i & 0x3F);
     return 1;
 }
-static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
+static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, Lf_Thr_t * t, int i )
 {
     int uMaskPage = (1 << LF_LOG_PAGE) - 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pGia, i );
@@ -371,37 +394,47 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
     assert( pObj->Value > 0 );
     if ( Entry == -1 ) // first visit
     {
-        if ( Vec_IntSize(&p->vFreeSets) == 0 ) // add new
+        if ( Vec_IntSize(&t->vFreeSets) == 0 && p->fParallel ) // take from the pool
         {
+            int k = Util_PthAtomicAdd( &p->nFreePool, -1 );
+            if ( k >= 0 )
+                Vec_IntPush( &t->vFreeSets, Vec_IntEntry(&p->vFreePool, k) );
+        }
+        if ( Vec_IntSize(&t->vFreeSets) == 0 ) // add new
+        {
+            // the page array is allocated in advance, so that the threads
+            // can take the pages while others read the cutsets
             Lf_Cut_t * pCut = (Lf_Cut_t *)ABC_CALLOC( word, p->nSetWords * (1 << LF_LOG_PAGE) );
-            int uMaskShift = Vec_PtrSize(&p->vMemSets) << LF_LOG_PAGE;
-            Vec_PtrPush( &p->vMemSets, pCut );
+            int iPage = Util_PthAtomicAdd( &p->nMemSets, 1 ) - 1;
+            int uMaskShift = iPage << LF_LOG_PAGE;
+            assert( iPage < Vec_PtrSize(&p->vMemSets) );
+            Vec_PtrWriteEntry( &p->vMemSets, iPage, pCut );
             for ( Entry = uMaskPage; Entry >= 0; Entry-- )
             {
-                Vec_IntPush( &p->vFreeSets, uMaskShift | Entry );
+                Vec_IntPush( &t->vFreeSets, uMaskShift | Entry );
                 pCut[Entry].nLeaves   = LF_NO_LEAF;
             }
         }
-        Entry = Vec_IntPop( &p->vFreeSets );
+        Entry = Vec_IntPop( &t->vFreeSets );
         Vec_IntWriteEntry( &p->vCutSets, iOffSet, Entry );
-        p->nFrontMax = Abc_MaxInt( p->nFrontMax, Entry + 1 );
+        t->nFrontMax = Abc_MaxInt( t->nFrontMax, Entry + 1 );
     }
-    else if ( --pObj->Value == 0 )
+    else if ( (p->fParallel ? Util_PthAtomicAdd((int *)&pObj->Value, -1) : (int)--pObj->Value) == 0 )
     {
-        Vec_IntPush( &p->vFreeSets, Entry );
+        // other fanouts of the same level may still read the cutset
+        Vec_IntPush( p->fParallel ? &t->vFreeNext : &t->vFreeSets, Entry );
         Vec_IntWriteEntry( &p->vCutSets, iOffSet, -1 );
     }
     return (Lf_Cut_t *)((word *)Vec_PtrEntry(&p->vMemSets, Entry >> LF_LOG_PAGE) + p->nSetWords * (Entry & uMaskPage));
 }
-static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, int Index, Lf_Cut_t ** ppCutSet )
+static inline int Lf_ManPrepareSet( Lf_Man_t * p, Lf_Thr_t * t, int iObj, int Index, Lf_Cut_t ** ppCutSet )
 {
-    static word CutTemp[3][LF_CUT_WORDS];
     if ( Vec_IntEntry(&p->vOffsets, iObj) == -1 )
-        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)CutTemp[Index]), iObj );
+        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)t->CutTemp[Index]), iObj );
     {
         Lf_Cut_t * pCut; 
         int i, nCutNum = p->pPars->nCutNum;
-        *ppCutSet = Lf_ManFetchSet(p, iObj);
+        *ppCutSet = Lf_ManFetchSet(p, t, iObj);
         Lf_CutSetForEachCut( p->nCutWords, *ppCutSet, pCut, i, nCutNum )
             if ( pCut->nLeaves == LF_NO_LEAF )
                 return i;
@@ -422,17 +455,11 @@ static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, int Index, Lf_Cut_t
 ***********************************************************************/
 static inline word Lf_CutGetSign( Lf_Cut_t * pCut )
 {
-    word Sign = 0; int i; 
-    for ( i = 0; i < (int)pCut->nLeaves; i++ )
-        Sign |= ((word)1) << (pCut->pLeaves[i] & 0x3F);
-    return Sign;
+    return Gia_CutGetSign( pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Lf_CutCountBits( word i )
 {
-    i = i - ((i >> 1) & 0x5555555555555555);
-    i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
-    i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
-    return (i*(0x0101010101010101))>>56;
+    return Gia_CutCountBits( i );
 }
 static inline int Lf_CutEqual( Lf_Cut_t * pCut0, Lf_Cut_t * pCut1 )
 {
@@ -522,17 +549,25 @@ static inline void Lf_MemAlloc( Lf_Mem_t * p, int LogPage, Vec_Ptr_t * vFree, in
     p->MaskPage  = (1 << LogPage) - 1;
     p->nCutWords = nCutWords;
     p->vFree     = vFree;
+    // the handles have 31 bits; the threads take the pages of this array
+    Vec_PtrFill( &p->vPages, 1 << (31 - LogPage), NULL );
 }
-static inline int Lf_MemSaveCut( Lf_Mem_t * p, Lf_Cut_t * pCut, int iObj )
+static inline int Lf_MemSaveCut( Lf_Mem_t * p, int * piCur, Lf_Cut_t * pCut, int iObj )
 {
     unsigned char * pPlace;
-    int i, iPlace, Prev = iObj, iCur = p->iCur;
+    int i, iPlace, iCur, Prev = iObj;
     assert( !pCut->fMux7 );
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> p->LogPage) )
-        Vec_PtrPush( &p->vPages, Vec_PtrSize(p->vFree) ? Vec_PtrPop(p->vFree) : ABC_ALLOC(char,p->MaskPage+1) );
-    assert( p->MaskPage - (p->iCur & p->MaskPage) >= 4 * (LF_LEAF_MAX + 2) );
+    if ( *piCur == -1 )
+    {
+        int iPage = Util_PthAtomicAdd( &p->nPages, 1 ) - 1;
+        assert( iPage < Vec_PtrSize(&p->vPages) );
+        Vec_PtrWriteEntry( &p->vPages, iPage, (p->vFree && Vec_PtrSize(p->vFree)) ? Vec_PtrPop(p->vFree) : ABC_ALLOC(char,p->MaskPage+1) );
+        *piCur = iPage << p->LogPage;
+    }
+    iCur = *piCur;
+    assert( p->MaskPage - (iCur & p->MaskPage) >= 4 * (LF_LEAF_MAX + 2) );
     iPlace = iCur & p->MaskPage;
-    pPlace = (unsigned char *)Vec_PtrEntry(&p->vPages, p->iCur >> p->LogPage);
+    pPlace = (unsigned char *)Vec_PtrEntry(&p->vPages, iCur >> p->LogPage);
     iPlace = Gia_AigerWriteUnsignedBuffer( pPlace, iPlace, pCut->nLeaves );
     for ( i = pCut->nLeaves - 1; i >= 0; i-- )
         iPlace = Gia_AigerWriteUnsignedBuffer( pPlace, iPlace, Prev - pCut->pLeaves[i] ), Prev = pCut->pLeaves[i];
@@ -540,16 +575,16 @@ static inline int Lf_MemSaveCut( Lf_Mem_t * p, Lf_Cut_t * pCut, int iObj )
     if ( pCut->iFunc >= 0 )
         iPlace = Gia_AigerWriteUnsignedBuffer( pPlace, iPlace, pCut->iFunc );
     if ( p->MaskPage - (iPlace & p->MaskPage) < 4 * (LF_LEAF_MAX + 2) )
-        p->iCur = ((p->iCur >> p->LogPage) + 1) << p->LogPage;
+        *piCur = -1;
     else
-        p->iCur = (p->iCur & ~p->MaskPage) | iPlace;
+        *piCur = (iCur & ~p->MaskPage) | iPlace;
     return iCur;
 }
 static inline Lf_Cut_t * Lf_MemLoadCut( Lf_Mem_t * p, int iCur, int iObj, Lf_Cut_t * pCut, int fTruth, int fRecycle )
 {
     unsigned char * pPlace;  
     int i, Prev = iObj, Page = iCur >> p->LogPage;
-    assert( Page < Vec_PtrSize(&p->vPages) );
+    assert( Page < p->nPages );
     pPlace = (unsigned char *)Vec_PtrEntry(&p->vPages, Page) + (iCur & p->MaskPage);
     pCut->nLeaves = Gia_AigerReadUnsigned(&pPlace);
     assert( pCut->nLeaves <= LF_LEAF_MAX );
@@ -557,7 +592,7 @@ static inline Lf_Cut_t * Lf_MemLoadCut( Lf_Mem_t * p, int iCur, int iObj, Lf_Cut
         pCut->pLeaves[i] = Prev - Gia_AigerReadUnsigned(&pPlace), Prev = pCut->pLeaves[i];
     pCut->iFunc = fTruth ? Gia_AigerReadUnsigned(&pPlace) : -1;
     assert( pCut->nLeaves >= 2 || pCut->iFunc <= 3 );
-    if ( fRecycle && Page && Vec_PtrEntry(&p->vPages, Page-1) )
+    if ( fRecycle && p->vFree && Page && Vec_PtrEntry(&p->vPages, Page-1) )
     {
         Vec_PtrPush( p->vFree, Vec_PtrEntry(&p->vPages, Page-1) );
         Vec_PtrWriteEntry( &p->vPages, Page-1, NULL );
@@ -569,11 +604,17 @@ static inline Lf_Cut_t * Lf_MemLoadCut( Lf_Mem_t * p, int iCur, int iObj, Lf_Cut
 static inline void Lf_MemRecycle( Lf_Mem_t * p )
 {
     void * pPlace; int i;
-    Vec_PtrForEachEntry( void *, &p->vPages, pPlace, i )
-        if ( pPlace )
+    Vec_PtrForEachEntryStop( void *, &p->vPages, pPlace, i, p->nPages )
+    {
+        if ( pPlace == NULL )
+            continue;
+        if ( p->vFree )
             Vec_PtrPush( p->vFree, pPlace );
-    Vec_PtrClear( &p->vPages );
-    p->iCur = 0;
+        else
+            ABC_FREE( pPlace );
+        Vec_PtrWriteEntry( &p->vPages, i, NULL );
+    }
+    p->nPages = 0;
 }
 static inline Lf_Cut_t * Lf_MemLoadMuxCut( Lf_Man_t * p, int iObj, Lf_Cut_t * pCut )
 {
@@ -587,10 +628,9 @@ static inline Lf_Cut_t * Lf_MemLoadMuxCut( Lf_Man_t * p, int iObj, Lf_Cut_t * pC
     pCut->fMux7 = 1;
     return pCut;
 }
-static inline Lf_Cut_t * Lf_ObjCutMux( Lf_Man_t * p, int i )
+static inline Lf_Cut_t * Lf_ObjCutMux( Lf_Man_t * p, Lf_Thr_t * t, int i )
 {
-    static word CutSet[LF_CUT_WORDS];
-    return Lf_MemLoadMuxCut( p, i, (Lf_Cut_t *)CutSet );
+    return Lf_MemLoadMuxCut( p, i, (Lf_Cut_t *)t->CutMux );
 }
 static inline Lf_Cut_t * Lf_ObjCutBest( Lf_Man_t * p, int i )
 {
@@ -684,64 +724,10 @@ static inline int Lf_SetCheckArray( Lf_Cut_t ** ppCuts, int nCuts )
 ***********************************************************************/
 static inline int Lf_CutMergeOrder( Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, Lf_Cut_t * pCut, int nLutSize )
 { 
-    int nSize0   = pCut0->nLeaves;
-    int nSize1   = pCut1->nLeaves;
-    int i, * pC0 = pCut0->pLeaves;
-    int k, * pC1 = pCut1->pLeaves;
-    int c, * pC  = pCut->pLeaves;
-    // the case of the largest cut sizes
-    if ( nSize0 == nLutSize && nSize1 == nLutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )  return 0;
-            pC[i] = pC0[i];
-        }
-        pCut->nLeaves = nLutSize;
-        pCut->iFunc = -1;
-        pCut->Sign = pCut0->Sign | pCut1->Sign;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > nLutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut->nLeaves = c;
-    pCut->iFunc = -1;
-    pCut->fMux7 = 0;
-    pCut->Sign = pCut0->Sign | pCut1->Sign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > nLutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut->nLeaves = c;
+    int nSize = Gia_CutMergeOrder( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize < 0 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = -1;
     pCut->fMux7 = 0;
     pCut->Sign = pCut0->Sign | pCut1->Sign;
@@ -797,29 +783,7 @@ static inline int Lf_CutMergeOrderMux( Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, Lf_Cu
 
 static inline int Lf_SetCutIsContainedOrder( Lf_Cut_t * pBase, Lf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int i, nSizeB = pBase->nLeaves;
-    int k, nSizeC = pCut->nLeaves;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 0; i < nSizeB; i++ )
-            if ( pBase->pLeaves[i] != pCut->pLeaves[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    if ( nSizeC == 0 )
-        return 1;
-    for ( i = k = 0; i < nSizeB; i++ )
-    {
-        if ( pBase->pLeaves[i] > pCut->pLeaves[k] )
-            return 0;
-        if ( pBase->pLeaves[i] == pCut->pLeaves[k] )
-        {
-            if ( ++k == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Gia_CutIsContainedOrder( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Lf_SetLastCutIsContained( Lf_Cut_t ** pCuts, int nCuts )
 {
@@ -1183,7 +1147,7 @@ static inline void Lf_CutParams( Lf_Man_t * p, Lf_Cut_t * pCut, int Required, fl
     }
 }
 
-void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
+void Lf_ObjMergeOrder( Lf_Man_t * p, Lf_Thr_t * t, int iObj )
 {
     word CutSet[LF_CUT_MAX][LF_CUT_WORDS] = {{0}};
     Lf_Cut_t * pCutSet0, * pCutSet1, * pCutSet2, * pCut0, * pCut1, * pCut2;
@@ -1197,8 +1161,8 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     int nCutWords  = p->nCutWords;
     int fComp0     = Gia_ObjFaninC0(pObj);
     int fComp1     = Gia_ObjFaninC1(pObj);
-    int nCuts0     = Lf_ManPrepareSet( p, Gia_ObjFaninId0(pObj, iObj), 0, &pCutSet0 );
-    int nCuts1     = Lf_ManPrepareSet( p, Gia_ObjFaninId1(pObj, iObj), 1, &pCutSet1 );
+    int nCuts0     = Lf_ManPrepareSet( p, t, Gia_ObjFaninId0(pObj, iObj), 0, &pCutSet0 );
+    int nCuts1     = Lf_ManPrepareSet( p, t, Gia_ObjFaninId1(pObj, iObj), 1, &pCutSet1 );
     int iSibl      = Gia_ObjSibl(p->pGia, iObj);
     int i, k, n, iCutUsed, nCutsR = 0;
     float Value1 = -1, Value2 = -1;
@@ -1227,13 +1191,13 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
             nCutsR = Lf_SetAddCut( pCutsR, nCutsR, nCutNum );
         }
         if ( pCutsR[0]->fLate )
-            p->nTimeFails++;
+            t->nTimeFails++;
     }
     if ( iSibl )
     {
         Gia_Obj_t * pObjE = Gia_ObjSiblObj(p->pGia, iObj);
         int fCompE = Gia_ObjPhase(pObj) ^ Gia_ObjPhase(pObjE);
-        int nCutsE = Lf_ManPrepareSet( p, iSibl, 2, &pCutSet2 );
+        int nCutsE = Lf_ManPrepareSet( p, t, iSibl, 2, &pCutSet2 );
         Lf_CutSetForEachCut( nCutWords, pCutSet2, pCut2, n, nCutsE )
         {
             if ( pCut2->pLeaves[0] == iSibl )
@@ -1249,8 +1213,8 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     {
         Lf_Cut_t * pCutSave = NULL;
         int fComp2 = Gia_ObjFaninC2(p->pGia, pObj);
-        int nCuts2 = Lf_ManPrepareSet( p, Gia_ObjFaninId2(p->pGia, iObj), 2, &pCutSet2 );
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        int nCuts2 = Lf_ManPrepareSet( p, t, Gia_ObjFaninId2(p->pGia, iObj), 2, &pCutSet2 );
+        t->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet1, pCut1, k, nCuts1 ) if ( (int)pCut1->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet2, pCut2, n, nCuts2 ) if ( (int)pCut2->nLeaves <= nLutSize )
@@ -1258,12 +1222,12 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
             pCutSave = pCut2;
             if ( Lf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            t->CutCount[1]++; 
             if ( !Lf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Lf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            t->CutCount[2]++;
             if ( p->pPars->fCutMin && Lf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Lf_CutGetSign(pCutsR[nCutsR]);
             if ( p->pPars->nLutSizeMux && p->pPars->nLutSizeMux == (int)pCutsR[nCutsR]->nLeaves && 
@@ -1282,12 +1246,12 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
                 assert( (int)pCut0->nLeaves + (int)pCut1->nLeaves + 1 <= p->pPars->nLutSize );
     //            if ( Lf_CutCountBits(pCut0->Sign | pCut1->Sign | pCutSave->Sign) > p->pPars->nLutSize )
     //                continue;
-                p->CutCount[1]++; 
+                t->CutCount[1]++; 
                 if ( !Lf_CutMergeOrderMux(pCut0, pCut1, pCutSave, pCutsR[nCutsR], p->pPars->nLutSize) )
                     continue;
                 if ( Lf_SetLastCutIsContained(pCutsR, nCutsR) )
                     continue;
-                p->CutCount[2]++;
+                t->CutCount[2]++;
                 if ( p->pPars->fCutMin && Lf_CutComputeTruthMux(p, pCut0, pCut1, pCutSave, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                     pCutsR[nCutsR]->Sign = Lf_CutGetSign(pCutsR[nCutsR]);
     //            if ( p->pPars->nLutSizeMux && p->pPars->nLutSizeMux == (int)pCutsR[nCutsR]->nLeaves && 
@@ -1301,18 +1265,26 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
-        Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
+        Lf_Cut_t * pCuts1[LF_CUT_MAX];
+        Gia_CutSoa_t Soa1;
+        unsigned Mask;
+        Gia_CutSoaClear( &Soa1 );
         Lf_CutSetForEachCut( nCutWords, pCutSet1, pCut1, k, nCuts1 ) if ( (int)pCut1->nLeaves <= nLutSize )
         {
-            if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Lf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
-                continue;
-            p->CutCount[1]++; 
+            pCuts1[Soa1.nCuts] = pCut1;
+            Gia_CutSoaPush( &Soa1, pCut1->nLeaves, pCut1->Sign );
+        }
+        t->CutCount[0] += nCuts0 * nCuts1;
+        Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
+        Gia_CutSoaForEachPair( &Soa1, pCut0->nLeaves, pCut0->Sign, nLutSize, Mask, k )
+        {
+            pCut1 = pCuts1[k];
+            t->CutCount[1]++; 
             if ( !Lf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Lf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            t->CutCount[2]++;
             if ( p->pPars->fCutMin && Lf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Lf_CutGetSign(pCutsR[nCutsR]);
             if ( p->pPars->nLutSizeMux && p->pPars->nLutSizeMux == (int)pCutsR[nCutsR]->nLeaves && 
@@ -1336,28 +1308,28 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     // delay cut
     assert( nCutsR == 1 || pCutsR[0]->Delay <= pCutsR[1]->Delay );
     pBest->Cut[0].fUsed = pBest->Cut[1].fUsed = 0;
-    pBest->Cut[0].Handle = pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, pCutsR[0], iObj);
+    pBest->Cut[0].Handle = pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, &t->iCur, pCutsR[0], iObj);
     pBest->Delay[0] = pBest->Delay[1] = pCutsR[0]->Delay;
     pBest->Flow[0] = pBest->Flow[1] = pCutsR[0]->Flow;
-    p->nCutCounts[pCutsR[0]->nLeaves]++;
-    p->CutCount[3] += nCutsR;
-    p->nCutEqual++;
+    t->nCutCounts[pCutsR[0]->nLeaves]++;
+    t->CutCount[3] += nCutsR;
+    t->nCutEqual++;
     // area cut
     iCutUsed = 0;
     if ( nCutsR > 1 && pCutsR[0]->Flow > pCutsR[1]->Flow + LF_EPSILON )//&& !pCutsR[1]->fLate ) // can remove !fLate
     {
-        pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, pCutsR[1], iObj);
+        pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, &t->iCur, pCutsR[1], iObj);
         pBest->Delay[1] = pCutsR[1]->Delay;
         pBest->Flow[1] = pCutsR[1]->Flow;
-        p->nCutCounts[pCutsR[1]->nLeaves]++;
-        p->nCutEqual--;
+        t->nCutCounts[pCutsR[1]->nLeaves]++;
+        t->nCutEqual--;
         if ( !pCutsR[1]->fLate )
             iCutUsed = 1;
     }
     // mux cut
     if ( p->pPars->fUseMux7 && Gia_ObjIsMuxId(p->pGia, iObj) )
     {
-        pCut2 = Lf_ObjCutMux( p, iObj );
+        pCut2 = Lf_ObjCutMux( p, t, iObj );
         Lf_CutParams( p, pCut2, Required, FlowRefs, pObj );
         pBest->Delay[2] = pCut2->Delay;
         pBest->Flow[2] = pCut2->Flow;
@@ -1380,7 +1352,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     if ( pObj->Value == 0 )
         return;
     // store the cutset
-    pCutSet = Lf_ManFetchSet(p, iObj);
+    pCutSet = Lf_ManFetchSet(p, t, iObj);
     Lf_CutSetForEachCut( nCutWords, pCutSet, pCut0, i, nCutNum )
     {
         assert( !pCut0->fMux7 );
@@ -1447,9 +1419,11 @@ void Lf_ManSetFlowRefs( Gia_Man_t * p, Vec_Flt_t * vRefs, Vec_Int_t * vOffsets )
 }
 void Lf_ManSetCutRefs( Lf_Man_t * p )
 {
-    Gia_Obj_t * pObj; int i;
-    if ( Vec_PtrSize(&p->vMemSets) * (1 << LF_LOG_PAGE) != Vec_IntSize(&p->vFreeSets) )
-        printf( "The number of used cutsets = %d.\n", Vec_PtrSize(&p->vMemSets) * (1 << LF_LOG_PAGE) - Vec_IntSize(&p->vFreeSets) );
+    Gia_Obj_t * pObj; int i, nFreeSets = 0;
+    for ( i = 0; i < p->nThreads; i++ )
+        nFreeSets += Vec_IntSize(&p->pThrs[i].vFreeSets);
+    if ( p->nMemSets * (1 << LF_LOG_PAGE) != nFreeSets )
+        printf( "The number of used cutsets = %d.\n", p->nMemSets * (1 << LF_LOG_PAGE) - nFreeSets );
     Gia_ManForEachAnd( p->pGia, pObj, i )
     {
         assert( pObj->Value == 0 );
@@ -1958,10 +1932,16 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     if ( pPars->fCutMin && pPars->fUseMux7 )
         Vec_MemAddMuxTT( p->vTtMem, pPars->nLutSize );
     p->pObjBests = ABC_CALLOC( Lf_Bst_t, Gia_ManAndNotBufNum(pGia) );
-    Vec_IntGrow( &p->vFreeSets, (1<<14) );
+    p->nThreads  = (pPars->nProcNum > 1 && !pPars->fCutMin) ? Abc_MinInt(pPars->nProcNum, UTIL_PTH_MAX) : 1;
+    p->pThrs     = ABC_CALLOC( Lf_Thr_t, p->nThreads );
+    for ( i = 0; i < p->nThreads; i++ )
+        Vec_IntGrow( &p->pThrs[i].vFreeSets, (1<<14) );
+    // the cutset handles are non-negative; the threads take the pages of this array
+    Vec_PtrFill( &p->vMemSets, 1 << (31 - LF_LOG_PAGE), NULL );
     Vec_PtrGrow( &p->vFreePages, 256 );
-    Lf_MemAlloc( &p->vStoreOld, 16, &p->vFreePages, p->nCutWords );
-    Lf_MemAlloc( &p->vStoreNew, 16, &p->vFreePages, p->nCutWords );
+    // with several threads, the pages are written out of order and cannot be recycled while loading
+    Lf_MemAlloc( &p->vStoreOld, 16, p->nThreads > 1 ? NULL : &p->vFreePages, p->nCutWords );
+    Lf_MemAlloc( &p->vStoreNew, 16, p->nThreads > 1 ? NULL : &p->vFreePages, p->nCutWords );
     Vec_IntFill( &p->vOffsets,  Gia_ManObjNum(pGia), -1 );
     Vec_IntFill( &p->vRequired, Gia_ManObjNum(pGia), ABC_INFINITY );
     Vec_IntFill( &p->vCutSets,  Gia_ManAndNotBufNum(pGia), -1 );
@@ -1980,6 +1960,7 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
 }
 void Lf_ManFree( Lf_Man_t * p )
 {
+    int i;
     ABC_FREE( p->pPars->pTimesArr );
     ABC_FREE( p->pPars->pTimesReq );
     if ( p->pPars->fCutMin )
@@ -1995,7 +1976,13 @@ void Lf_ManFree( Lf_Man_t * p )
     ABC_FREE( p->vStoreOld.vPages.pArray );
     ABC_FREE( p->vStoreNew.vPages.pArray );
     ABC_FREE( p->vFreePages.pArray );
-    ABC_FREE( p->vFreeSets.pArray );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ABC_FREE( p->pThrs[i].vFreeSets.pArray );
+        ABC_FREE( p->pThrs[i].vFreeNext.pArray );
+    }
+    ABC_FREE( p->pThrs );
+    ABC_FREE( p->vFreePool.pArray );
     ABC_FREE( p->vOffsets.pArray );
     ABC_FREE( p->vRequired.pArray );
     ABC_FREE( p->vCutSets.pArray );
@@ -2046,6 +2033,7 @@ void Lf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  LF_LEAF_MAX;
     pPars->nCutNumMax   =  LF_CUT_MAX;
+    pPars->nProcNumMax  =  UTIL_PTH_MAX;
 }
 void Lf_ManPrintStats( Lf_Man_t * p, char * pTitle )
 {
@@ -2078,6 +2066,8 @@ void Lf_ManPrintInit( Lf_Man_t * p )
     printf( "CutMin = %d  ",  p->pPars->fCutMin );
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
     printf( "Cut/Set = %d/%d Bytes", 8*p->nCutWords, 8*p->nSetWords );
+    if ( p->nThreads > 1 )
+        printf( "  Threads = %d", p->nThreads );
     printf( "\n" );
     printf( "Computing cuts...\r" );
     fflush( stdout );
@@ -2086,8 +2076,8 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
 {
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(int) * (2 * Gia_ManObjNum(p->pGia) + 3 * Gia_ManAndNotBufNum(p->pGia)) / (1<<20); // offset, required, cutsets, maprefs, flowrefs
-    float MemCutsB = 1.0 * (p->vStoreOld.MaskPage + 1) * (Vec_PtrSize(&p->vFreePages) + Vec_PtrSize(&p->vStoreOld.vPages)) / (1<<20) + 1.0 * sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia) / (1<<20);
-    float MemCutsF = 1.0 * sizeof(word) * p->nSetWords * (1<<LF_LOG_PAGE) * Vec_PtrSize(&p->vMemSets) / (1<<20);
+    float MemCutsB = 1.0 * (p->vStoreOld.MaskPage + 1) * (Vec_PtrSize(&p->vFreePages) + p->vStoreOld.nPages) / (1<<20) + 1.0 * sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia) / (1<<20);
+    float MemCutsF = 1.0 * sizeof(word) * p->nSetWords * (1<<LF_LOG_PAGE) * p->nMemSets / (1<<20);
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
@@ -2135,11 +2125,78 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
     Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     fflush( stdout );
 }
+static inline void Lf_ManFlushFreeSets( Lf_Thr_t * t )
+{
+    Vec_IntAppend( &t->vFreeSets, &t->vFreeNext );
+    Vec_IntClear( &t->vFreeNext );
+}
+static void Lf_ManComputeMappingTask( void * pUser, int * pObjs, int nObjs, int iLevel, int iThread )
+{
+    Lf_Man_t * p = (Lf_Man_t *)pUser;
+    Lf_Thr_t * t = p->pThrs + iThread;
+    int i;
+    for ( i = 0; i < nObjs; i++ )
+        if ( !Gia_ObjIsBuf(Gia_ManObj(p->pGia, pObjs[i])) )
+            Lf_ObjMergeOrder( p, t, pObjs[i] );
+}
+static void Lf_ManComputeMappingLevel( void * pUser, int iLevel )
+{
+    Lf_Man_t * p = (Lf_Man_t *)pUser;
+    Lf_Thr_t * t;
+    // the fanouts of the cutsets freed at this level are completed, so the cutsets 
+    // are added to the pool, from which any thread can take them at the next levels
+    Vec_IntShrink( &p->vFreePool, Abc_MaxInt(p->nFreePool, 0) );
+    for ( t = p->pThrs; t < p->pThrs + p->nThreads; t++ )
+    {
+        Vec_IntAppend( &p->vFreePool, &t->vFreeNext );
+        Vec_IntClear( &t->vFreeNext );
+    }
+    p->nFreePool = Vec_IntSize( &p->vFreePool );
+}
+void Lf_ManStartFreePool( Lf_Man_t * p )
+{
+    // the serial rounds keep the free cutsets in the first thread
+    Vec_IntClear( &p->vFreePool );
+    Vec_IntAppend( &p->vFreePool, &p->pThrs[0].vFreeSets );
+    Vec_IntClear( &p->pThrs[0].vFreeSets );
+    p->nFreePool = Vec_IntSize( &p->vFreePool );
+}
+void Lf_ManCollectStats( Lf_Man_t * p )
+{
+    Lf_Thr_t * t;
+    int k;
+    // the free cutsets are returned to the first thread, which is used by the serial rounds
+    Vec_IntShrink( &p->vFreePool, Abc_MaxInt(p->nFreePool, 0) );
+    Vec_IntAppend( &p->pThrs[0].vFreeSets, &p->vFreePool );
+    Vec_IntClear( &p->vFreePool );
+    p->nFreePool = 0;
+    for ( t = p->pThrs; t < p->pThrs + p->nThreads; t++ )
+    {
+        Lf_ManFlushFreeSets( t );
+        if ( t > p->pThrs )
+        {
+            Vec_IntAppend( &p->pThrs[0].vFreeSets, &t->vFreeSets );
+            Vec_IntClear( &t->vFreeSets );
+        }
+        for ( k = 0; k < 4; k++ )
+            p->CutCount[k] += t->CutCount[k];
+        for ( k = 0; k <= LF_LEAF_MAX; k++ )
+            p->nCutCounts[k] += t->nCutCounts[k];
+        p->nFrontMax   = Abc_MaxInt( p->nFrontMax, t->nFrontMax );
+        p->nTimeFails += t->nTimeFails;
+        p->nCutEqual  += t->nCutEqual;
+        memset( t->CutCount, 0, sizeof(double) * 4 );
+        memset( t->nCutCounts, 0, sizeof(int) * (LF_LEAF_MAX+1) );
+        t->nTimeFails = t->nCutEqual = 0;
+    }
+}
 void Lf_ManComputeMapping( Lf_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int i, arrTime;
-    assert( p->vStoreNew.iCur == 0 );
+    assert( p->vStoreNew.nPages == 0 );
+    for ( i = 0; i < p->nThreads; i++ )
+        p->pThrs[i].iCur = -1;
     Lf_ManSetCutRefs( p );
     if ( p->pGia->pManTime != NULL )
     {
@@ -2150,7 +2207,7 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
             if ( Gia_ObjIsBuf(pObj) )
                 continue;
             if ( Gia_ObjIsAnd(pObj) )
-                Lf_ObjMergeOrder( p, i );
+                Lf_ObjMergeOrder( p, p->pThrs, i );
             else if ( Gia_ObjIsCi(pObj) )
             {
                 arrTime = Tim_ManGetCiArrival( (Tim_Man_t*)p->pGia->pManTime, Gia_ObjCioId(pObj) );
@@ -2165,12 +2222,24 @@ void Lf_ManComputeMapping( Lf_Man_t * p )
         }
 //        Tim_ManPrint( p->pGia->pManTime );
     }
+    else if ( p->nThreads > 1 && !p->fUseEla )
+    {
+        // the nodes of one level depend only on the cuts of the lower levels;
+        // exact local area references the MFFCs, so those rounds stay serial
+        Vec_Wec_t * vLevels = Gia_ManLevParCollect( p->pGia );
+        Lf_ManStartFreePool( p );
+        p->fParallel = 1;
+        Gia_ManLevParRun( vLevels, p->nThreads, Lf_ManComputeMappingTask, Lf_ManComputeMappingLevel, p );
+        p->fParallel = 0;
+        Vec_WecFree( vLevels );
+    }
     else
     {
         Gia_ManForEachAnd( p->pGia, pObj, i )
             if ( !Gia_ObjIsBuf(pObj) )
-                Lf_ObjMergeOrder( p, i );
+                Lf_ObjMergeOrder( p, p->pThrs, i );
     }
+    Lf_ManCollectStats( p );
     Lf_MemRecycle( &p->vStoreOld );
     ABC_SWAP( Lf_Mem_t, p->vStoreOld, p->vStoreNew );
     if ( p->fUseEla )
@@ -153,8 +153,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Gia_ManStopP( &p->pAigExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
-    Vec_IntErase( &p->vHash );
-    Vec_IntErase( &p->vHTable );
+    ABC_FREE( p->pHTable );
     Vec_IntErase( &p->vRefs );
     ABC_FREE( p->pData2 );
     ABC_FREE( p->pTravIds );
@@ -195,7 +194,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
-    Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(int) * GIA_HASH_SLOT * (double)p->nHTable;
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
@@ -208,6 +207,141 @@ double Gia_ManMemory( Gia_Man_t * p )
     return Memory;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Compares the compact and the wide object layouts.]
+
+  Description [Copies the AIG into arrays of objects using the compact 
+  (12-byte, 29-bit fanin diffs) and the wide (24-byte, 31-bit fanin diffs, 
+  64-bit values) layouts and runs the same bit-parallel traversal over them. Reports 
+  the memory of each object array and the traversal speed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_ObjCompact_t_ Gia_ObjCompact_t;
+struct Gia_ObjCompact_t_
+{
+    unsigned       iDiff0 :  29;
+    unsigned       fCompl0:   1;
+    unsigned       fMark0 :   1;
+    unsigned       fTerm  :   1;
+    unsigned       iDiff1 :  29;
+    unsigned       fCompl1:   1;
+    unsigned       fMark1 :   1;
+    unsigned       fPhase :   1;
+    unsigned       Value;
+};
+typedef struct Gia_ObjWide_t_ Gia_ObjWide_t;
+struct Gia_ObjWide_t_
+{
+    unsigned       iDiff0 :  31;
+    unsigned       fCompl0:   1;
+    unsigned       iDiff1 :  31;
+    unsigned       fCompl1:   1;
+    unsigned       fMark0 :   1;
+    unsigned       fTerm  :   1;
+    unsigned       fMark1 :   1;
+    unsigned       fPhase :   1;
+    unsigned       fUnused:  28;
+    word           Value;
+};
+static unsigned Gia_ManBenchLayoutCompact( Gia_ObjCompact_t * pObjs, int nObjs, int nIters )
+{
+    Gia_ObjCompact_t * pObj, * pStop = pObjs + nObjs;
+    unsigned Value0, Value1, Res = 0;
+    int i;
+    for ( i = 0; i < nIters; i++ )
+    {
+        for ( pObj = pObjs + 1; pObj < pStop; pObj++ )
+        {
+            if ( pObj->fTerm )
+                continue;
+            Value0 = (pObj - pObj->iDiff0)->Value ^ (0 - (unsigned)pObj->fCompl0);
+            Value1 = (pObj - pObj->iDiff1)->Value ^ (0 - (unsigned)pObj->fCompl1);
+            pObj->Value = Value0 & Value1;
+        }
+        Res ^= pStop[-1].Value;
+    }
+    return Res;
+}
+static unsigned Gia_ManBenchLayoutWide( Gia_ObjWide_t * pObjs, int nObjs, int nIters )
+{
+    Gia_ObjWide_t * pObj, * pStop = pObjs + nObjs;
+    unsigned Value0, Value1, Res = 0;
+    int i;
+    for ( i = 0; i < nIters; i++ )
+    {
+        for ( pObj = pObjs + 1; pObj < pStop; pObj++ )
+        {
+            if ( pObj->fTerm )
+                continue;
+            Value0 = (unsigned)(pObj - pObj->iDiff0)->Value ^ (0 - (unsigned)pObj->fCompl0);
+            Value1 = (unsigned)(pObj - pObj->iDiff1)->Value ^ (0 - (unsigned)pObj->fCompl1);
+            pObj->Value = Value0 & Value1;
+        }
+        Res ^= (unsigned)pStop[-1].Value;
+    }
+    return Res;
+}
+void Gia_ManBenchLayout( Gia_Man_t * p, int nIters, int fVerbose )
+{
+    Gia_ObjCompact_t * pCompact;
+    Gia_ObjWide_t * pWide;
+    Gia_Obj_t * pObj;
+    unsigned ResC, ResW;
+    abctime clk, clkC, clkW;
+    double nNodes = (double)Gia_ManAndNum(p) * nIters;
+    int i, nObjs = Gia_ManObjNum(p);
+    if ( nObjs > (1 << 29) )
+    {
+        printf( "The AIG with %d objects cannot be represented using the compact layout.\n", nObjs );
+        return;
+    }
+    pCompact = ABC_CALLOC( Gia_ObjCompact_t, nObjs );
+    pWide    = ABC_CALLOC( Gia_ObjWide_t, nObjs );
+    Abc_Random( 1 );
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        unsigned Rand = Abc_Random( 0 );
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            pCompact[i].iDiff0  = pWide[i].iDiff0  = Gia_ObjDiff0(pObj);
+            pCompact[i].iDiff1  = pWide[i].iDiff1  = Gia_ObjDiff1(pObj);
+            pCompact[i].fCompl0 = pWide[i].fCompl0 = Gia_ObjFaninC0(pObj);
+            pCompact[i].fCompl1 = pWide[i].fCompl1 = Gia_ObjFaninC1(pObj);
+        }
+        else
+        {
+            pCompact[i].fTerm = pWide[i].fTerm = 1;
+            pCompact[i].Value = pWide[i].Value = Gia_ObjIsCi(pObj) ? Rand : 0;
+        }
+    }
+    clk  = Abc_Clock();
+    ResC = Gia_ManBenchLayoutCompact( pCompact, nObjs, nIters );
+    clkC = Abc_Clock() - clk;
+    clk  = Abc_Clock();
+    ResW = Gia_ManBenchLayoutWide( pWide, nObjs, nIters );
+    clkW = Abc_Clock() - clk;
+    if ( ResC != ResW )
+        printf( "Gia_ManBenchLayout(): Traversal results do not match.\n" );
+    printf( "Objects = %d.  Iterations = %d.  Current build uses the %s layout (%d bytes per object).\n", 
+        nObjs, nIters, sizeof(Gia_Obj_t) == sizeof(Gia_ObjWide_t) ? "wide" : "compact", (int)sizeof(Gia_Obj_t) );
+    printf( "Compact: Obj = %2d bytes  Mem = %8.2f MB  Limit = 2^29  ", (int)sizeof(Gia_ObjCompact_t), 1.0*nObjs*sizeof(Gia_ObjCompact_t)/(1<<20) );
+    printf( "Speed = %8.2f Mnodes/sec  ", clkC ? nNodes / (1.0*clkC/CLOCKS_PER_SEC) / 1000000 : 0.0 );
+    Abc_PrintTime( 1, "Time", clkC );
+    printf( "Wide:    Obj = %2d bytes  Mem = %8.2f MB  Limit = 2^31  ", (int)sizeof(Gia_ObjWide_t), 1.0*nObjs*sizeof(Gia_ObjWide_t)/(1<<20) );
+    printf( "Speed = %8.2f Mnodes/sec  ", clkW ? nNodes / (1.0*clkW/CLOCKS_PER_SEC) / 1000000 : 0.0 );
+    Abc_PrintTime( 1, "Time", clkW );
+    if ( fVerbose )
+        printf( "Wide layout uses %.2f times more memory and is %.2f times slower.\n", 
+            1.0*sizeof(Gia_ObjWide_t)/sizeof(Gia_ObjCompact_t), clkC ? 1.0*clkW/clkC : 0.0 );
+    ABC_FREE( pCompact );
+    ABC_FREE( pWide );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Stops the AIG manager.]
@@ -19,12 +19,14 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "giaCutEnum.h"
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -59,6 +61,13 @@ struct Mf_Obj_t_
     unsigned        Delay    : 16;  // delay 
     unsigned        nMapRefs : 16;  // map references
 };
+typedef struct Mf_Thr_t_ Mf_Thr_t; 
+struct Mf_Thr_t_
+{
+    int             iCur;           // current position (0 if there is no page)
+    double          CutCount[4];    // cut counts
+    int             nCutCounts[MF_LEAF_MAX+1];
+};
 typedef struct Mf_Man_t_ Mf_Man_t; 
 struct Mf_Man_t_
 {
@@ -73,7 +82,9 @@ struct Mf_Man_t_
     Vec_Int_t       vCnfSizes;      // handles to CNF
     Vec_Int_t       vCnfMem;        // memory for CNF
     Vec_Int_t       vTemp;          // temporary array
-    int             iCur;           // current position
+    int             nPages;         // the number of used pages
+    Mf_Thr_t *      pThrs;          // per-thread cut computation data
+    int             nThreads;       // the number of threads
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
     // statistics
@@ -334,22 +345,9 @@ Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pn
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
+void Mf_ManDeriveCnfIds( Mf_Man_t * p, int fCnfObjIds, Vec_Int_t * vCnfIds, int nVars )
 {
-    Cnf_Dat_t * pCnf; 
-    Gia_Obj_t * pObj;
-    int Id, DriId, nVars, nClas, nLits, iVar = 1, iCla = 0, iLit = 0;
-    Vec_Int_t * vCnfs = Mf_ManDeriveCnfs( p, &nVars, &nClas, &nLits );
-    Vec_Int_t * vCnfIds = Vec_IntStartFull( Gia_ManObjNum(p->pGia) );
-    int pFanins[16], * pCut, * pCnfIds = Vec_IntArray( vCnfIds );
-    int i, k, c, iFunc, nCubes, * pCubes, fComplLast;
-    nVars++;  // zero-ID to remain unused
-    if ( fAddOrCla )
-    {
-        nClas++;
-        nLits += Gia_ManCoNum(p->pGia);
-    }
-    // create CNF IDs
+    int i, Id, iVar = 1;
     if ( fCnfObjIds )
     {
         iVar += 1 + Gia_ManCiNum(p->pGia) + Gia_ManCoNum(p->pGia);
@@ -375,6 +373,24 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
             Vec_IntWriteEntry( vCnfIds, Id, iVar++ );
         assert( iVar == nVars );
     }
+}
+Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
+{
+    Cnf_Dat_t * pCnf; 
+    Gia_Obj_t * pObj;
+    int Id, DriId, nVars, nClas, nLits, iCla = 0, iLit = 0;
+    Vec_Int_t * vCnfs = Mf_ManDeriveCnfs( p, &nVars, &nClas, &nLits );
+    Vec_Int_t * vCnfIds = Vec_IntStartFull( Gia_ManObjNum(p->pGia) );
+    int pFanins[16], * pCut, * pCnfIds = Vec_IntArray( vCnfIds );
+    int i, k, c, iFunc, nCubes, * pCubes, fComplLast;
+    nVars++;  // zero-ID to remain unused
+    if ( fAddOrCla )
+    {
+        nClas++;
+        nLits += Gia_ManCoNum(p->pGia);
+    }
+    // create CNF IDs
+    Mf_ManDeriveCnfIds( p, fCnfObjIds, vCnfIds, nVars );
     // generate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
     pCnf->pMan        = (Aig_Man_t *)p->pGia;
@@ -530,6 +546,110 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF for the AIG using the mapping into a file.]
+
+  Description [Writes the same clauses as Mf_ManDeriveCnf() without 
+  creating the clause arrays. The numbers of variables and clauses are
+  counted first, while the clauses of each function used in the mapping
+  are computed once. Then the clauses of the nodes are written into the 
+  file as they are generated, so the memory used is proportional to the
+  AIG size. The file is compressed if its name ends in ".gz".]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Mf_ManWriteCnf( Mf_Man_t * p, char * pFileName, int fCnfObjIds, int fAddOrCla )
+{
+    Cnf_File_t * pFile;
+    Gia_Obj_t * pObj;
+    int Id, DriId, nVars, nClas, nLits, nClaLits;
+    Vec_Int_t * vCnfs = Mf_ManDeriveCnfs( p, &nVars, &nClas, &nLits );
+    Vec_Int_t * vCnfIds = Vec_IntStartFull( Gia_ManObjNum(p->pGia) );
+    int pFanins[16], pLits[16], * pCut, * pCnfIds = Vec_IntArray( vCnfIds );
+    int i, k, c, iFunc, nCubes, * pCubes, fComplLast;
+    nVars++;  // zero-ID to remain unused
+    if ( fAddOrCla )
+    {
+        nClas++;
+        nLits += Gia_ManCoNum(p->pGia);
+    }
+    Mf_ManDeriveCnfIds( p, fCnfObjIds, vCnfIds, nVars );
+    pFile = Cnf_FileStart( pFileName, nVars, nClas );
+    if ( pFile == NULL )
+    {
+        Vec_IntFree( vCnfs );
+        Vec_IntFree( vCnfIds );
+        return 0;
+    }
+    // add last clause
+    if ( fAddOrCla )
+    {
+        Vec_Int_t * vOrLits = Vec_IntAlloc( Gia_ManCoNum(p->pGia) );
+        Gia_ManForEachCoId( p->pGia, Id, i )
+            Vec_IntPush( vOrLits, Abc_Var2Lit(pCnfIds[Id], 0) );
+        Cnf_FileAddClause( pFile, Vec_IntArray(vOrLits), Vec_IntSize(vOrLits) );
+        Vec_IntFree( vOrLits );
+    }
+    // add clauses for the COs
+    Gia_ManForEachCo( p->pGia, pObj, i )
+    {
+        Id = Gia_ObjId( p->pGia, pObj );
+        DriId = Gia_ObjFaninId0( pObj, Id );
+        pLits[0] = Abc_Var2Lit(pCnfIds[Id], 0);
+        pLits[1] = Abc_Var2Lit(pCnfIds[DriId], !Gia_ObjFaninC0(pObj));
+        Cnf_FileAddClause( pFile, pLits, 2 );
+        pLits[0] = Abc_Var2Lit(pCnfIds[Id], 1);
+        pLits[1] = Abc_Var2Lit(pCnfIds[DriId], Gia_ObjFaninC0(pObj));
+        Cnf_FileAddClause( pFile, pLits, 2 );
+    }
+    // add clauses for the mapping
+    Gia_ManForEachAndReverseId( p->pGia, Id )
+    {
+        if ( !Mf_ObjMapRefNum(p, Id) )
+            continue;
+        pCut = Mf_ObjCutBest( p, Id );
+        iFunc = Abc_Lit2Var( Mf_CutFunc(pCut) );
+        fComplLast = Abc_LitIsCompl( Mf_CutFunc(pCut) );
+        if ( iFunc == 0 ) // constant cut
+        {
+            pLits[0] = Abc_Var2Lit(pCnfIds[Id], !fComplLast);
+            Cnf_FileAddClause( pFile, pLits, 1 );
+            continue;
+        }
+        for ( k = 0; k < Mf_CutSize(pCut); k++ )
+            pFanins[k] = pCnfIds[pCut[k+1]];
+        pFanins[k++] = pCnfIds[Id];
+        // get clauses
+        pCubes = Vec_IntEntryP( vCnfs, Vec_IntEntry(vCnfs, iFunc) );
+        nCubes = *pCubes++;
+        for ( c = 0; c < nCubes; c++ )
+        {
+            nClaLits = 0;
+            k = Mf_CutSize(pCut);
+            assert( Mf_CubeLit(pCubes[c], k) );
+            pLits[nClaLits++] = Abc_Var2Lit( pFanins[k], (Mf_CubeLit(pCubes[c], k) == 2) ^ fComplLast );
+            for ( k = 0; k < Mf_CutSize(pCut); k++ )
+                if ( Mf_CubeLit(pCubes[c], k) )
+                    pLits[nClaLits++] = Abc_Var2Lit( pFanins[k], Mf_CubeLit(pCubes[c], k) == 2 );
+            Cnf_FileAddClause( pFile, pLits, nClaLits );
+        }
+    }
+    // constant clause
+    pLits[0] = Abc_Var2Lit(pCnfIds[0], 1);
+    Cnf_FileAddClause( pFile, pLits, 1 );
+    Cnf_FileStop( pFile );
+    Vec_IntFree( vCnfs );
+    Vec_IntFree( vCnfIds );
+    p->pPars->nCnfVars     = nVars;
+    p->pPars->nCnfClauses  = nClas;
+    p->pPars->nCnfLiterals = nLits;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -664,17 +784,11 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
 ***********************************************************************/
 static inline int Mf_CutCountBits( word i )
 {
-    i = i - ((i >> 1) & 0x5555555555555555);
-    i = (i & 0x3333333333333333) + ((i >> 2) & 0x3333333333333333);
-    i = ((i + (i >> 4)) & 0x0F0F0F0F0F0F0F0F);
-    return (i*(0x0101010101010101))>>56;
+    return Gia_CutCountBits( i );
 }
 static inline word Mf_CutGetSign( int * pLeaves, int nLeaves )
 {
-    word Sign = 0; int i; 
-    for ( i = 0; i < nLeaves; i++ )
-        Sign |= ((word)1) << (pLeaves[i] & 0x3F);
-    return Sign;
+    return Gia_CutGetSign( pLeaves, nLeaves );
 }
 static inline int Mf_CutCreateUnit( Mf_Cut_t * p, int i )
 {
@@ -729,16 +843,23 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAllocPage( Mf_Man_t * p )
+{
+    // the page array is allocated in advance, so that the threads
+    // can take the pages while others read the cuts
+    int iPage = Util_PthAtomicAdd( &p->nPages, 1 ) - 1;
+    assert( iPage < Vec_PtrSize(&p->vPages) );
+    Vec_PtrWriteEntry( &p->vPages, iPage, ABC_ALLOC(int, (1<<16)) );
+    return iPage ? iPage << 16 : 2; // handle 0 stands for no cutset
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Thr_t * t, Mf_Cut_t ** pCuts, int nCuts )
 {
     int i, * pPlace, iCur, nInts = 1;
     for ( i = 0; i < nCuts; i++ )
         nInts += pCuts[i]->nLeaves + 1;
-    if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
-        p->iCur = ((p->iCur >> 16) + 1) << 16;
-    if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
-    iCur = p->iCur; p->iCur += nInts;
+    if ( t->iCur == 0 || (t->iCur & 0xFFFF) + nInts > 0xFFFF )
+        t->iCur = Mf_ManAllocPage( p );
+    iCur = t->iCur; t->iCur += nInts;
     pPlace = Mf_ManCutSet( p, iCur );
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
@@ -832,63 +953,10 @@ static inline int Mf_SetCheckArray( Mf_Cut_t ** ppCuts, int nCuts )
 ***********************************************************************/
 static inline int Mf_CutMergeOrder( Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cut_t * pCut, int nLutSize )
 { 
-    int nSize0   = pCut0->nLeaves;
-    int nSize1   = pCut1->nLeaves;
-    int i, * pC0 = pCut0->pLeaves;
-    int k, * pC1 = pCut1->pLeaves;
-    int c, * pC  = pCut->pLeaves;
-    // the case of the largest cut sizes
-    if ( nSize0 == nLutSize && nSize1 == nLutSize )
-    {
-        for ( i = 0; i < nSize0; i++ )
-        {
-            if ( pC0[i] != pC1[i] )  return 0;
-            pC[i] = pC0[i];
-        }
-        pCut->nLeaves = nLutSize;
-        pCut->iFunc = MF_NO_FUNC;
-        pCut->Sign = pCut0->Sign | pCut1->Sign;
-        return 1;
-    }
-    // compare two cuts with different numbers
-    i = k = c = 0;
-    if ( nSize0 == 0 ) goto FlushCut1;
-    if ( nSize1 == 0 ) goto FlushCut0;
-    while ( 1 )
-    {
-        if ( c == nLutSize ) return 0;
-        if ( pC0[i] < pC1[k] )
-        {
-            pC[c++] = pC0[i++];
-            if ( i >= nSize0 ) goto FlushCut1;
-        }
-        else if ( pC0[i] > pC1[k] )
-        {
-            pC[c++] = pC1[k++];
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-        else
-        {
-            pC[c++] = pC0[i++]; k++;
-            if ( i >= nSize0 ) goto FlushCut1;
-            if ( k >= nSize1 ) goto FlushCut0;
-        }
-    }
-
-FlushCut0:
-    if ( c + nSize0 > nLutSize + i ) return 0;
-    while ( i < nSize0 )
-        pC[c++] = pC0[i++];
-    pCut->nLeaves = c;
-    pCut->iFunc = MF_NO_FUNC;
-    pCut->Sign = pCut0->Sign | pCut1->Sign;
-    return 1;
-
-FlushCut1:
-    if ( c + nSize1 > nLutSize + k ) return 0;
-    while ( k < nSize1 )
-        pC[c++] = pC1[k++];
-    pCut->nLeaves = c;
+    int nSize = Gia_CutMergeOrder( pCut0->pLeaves, pCut0->nLeaves, pCut1->pLeaves, pCut1->nLeaves, pCut->pLeaves, nLutSize );
+    if ( nSize < 0 )
+        return 0;
+    pCut->nLeaves = nSize;
     pCut->iFunc = MF_NO_FUNC;
     pCut->Sign = pCut0->Sign | pCut1->Sign;
     return 1;
@@ -919,29 +987,7 @@ static inline int Mf_CutMergeOrderMux( Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cu
 }
 static inline int Mf_SetCutIsContainedOrder( Mf_Cut_t * pBase, Mf_Cut_t * pCut ) // check if pCut is contained in pBase
 {
-    int i, nSizeB = pBase->nLeaves;
-    int k, nSizeC = pCut->nLeaves;
-    if ( nSizeB == nSizeC )
-    {
-        for ( i = 0; i < nSizeB; i++ )
-            if ( pBase->pLeaves[i] != pCut->pLeaves[i] )
-                return 0;
-        return 1;
-    }
-    assert( nSizeB > nSizeC ); 
-    if ( nSizeC == 0 )
-        return 1;
-    for ( i = k = 0; i < nSizeB; i++ )
-    {
-        if ( pBase->pLeaves[i] > pCut->pLeaves[k] )
-            return 0;
-        if ( pBase->pLeaves[i] == pCut->pLeaves[k] )
-        {
-            if ( ++k == nSizeC )
-                return 1;
-        }
-    }
-    return 0;
+    return Gia_CutIsContainedOrder( pBase->pLeaves, pBase->nLeaves, pCut->pLeaves, pCut->nLeaves );
 }
 static inline int Mf_SetLastCutIsContained( Mf_Cut_t ** pCuts, int nCuts )
 {
@@ -1023,7 +1069,7 @@ static inline void Mf_CutParams( Mf_Man_t * p, Mf_Cut_t * pCut, float FlowRefs )
     pCut->Delay += (int)(nLeaves > 1);
     pCut->Flow = (pCut->Flow + Mf_CutArea(p, nLeaves, pCut->iFunc)) / FlowRefs;
 }
-void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
+void Mf_ObjMergeOrder( Mf_Man_t * p, Mf_Thr_t * t, int iObj )
 {
     Mf_Cut_t pCuts0[MF_CUT_MAX], pCuts1[MF_CUT_MAX], pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
@@ -1036,7 +1082,7 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     int fComp1   = Gia_ObjFaninC1(pObj);
     int iSibl    = Gia_ObjSibl(p->pGia, iObj);
     Mf_Cut_t * pCut0, * pCut1, * pCut0Lim = pCuts0 + nCuts0, * pCut1Lim = pCuts1 + nCuts1;
-    int i, nCutsR = 0;
+    int i, k, nCutsR = 0;
     for ( i = 0; i < nCutNum; i++ )
         pCutsR[i] = pCuts + i;
     if ( iSibl )
@@ -1061,19 +1107,19 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
         int nCuts2  = Mf_ManPrepareCuts(pCuts2, p, Gia_ObjFaninId2(p->pGia, iObj), 1);
         int fComp2  = Gia_ObjFaninC2(p->pGia, pObj);
         Mf_Cut_t * pCut2, * pCut2Lim = pCuts2 + nCuts2;
-        p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
+        t->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
         for ( pCut2 = pCuts2; pCut2 < pCut2Lim; pCut2++ )
         {
             if ( Mf_CutCountBits(pCut0->Sign | pCut1->Sign | pCut2->Sign) > nLutSize )
                 continue;
-            p->CutCount[1]++; 
+            t->CutCount[1]++; 
             if ( !Mf_CutMergeOrderMux(pCut0, pCut1, pCut2, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            t->CutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruthMux(p, pCut0, pCut1, pCut2, fComp0, fComp1, fComp2, pCutsR[nCutsR]) )
                 pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
@@ -1083,18 +1129,22 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     else
     {
         int fIsXor = Gia_ObjIsXor(pObj);
-        p->CutCount[0] += nCuts0 * nCuts1;
-        for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
+        Gia_CutSoa_t Soa1;
+        unsigned Mask;
+        Gia_CutSoaClear( &Soa1 );
         for ( pCut1 = pCuts1; pCut1 < pCut1Lim; pCut1++ )
+            Gia_CutSoaPush( &Soa1, pCut1->nLeaves, pCut1->Sign );
+        t->CutCount[0] += nCuts0 * nCuts1;
+        for ( pCut0 = pCuts0; pCut0 < pCut0Lim; pCut0++ )
+        Gia_CutSoaForEachPair( &Soa1, pCut0->nLeaves, pCut0->Sign, nLutSize, Mask, k )
         {
-            if ( (int)(pCut0->nLeaves + pCut1->nLeaves) > nLutSize && Mf_CutCountBits(pCut0->Sign | pCut1->Sign) > nLutSize )
-                continue;
-            p->CutCount[1]++; 
+            pCut1 = pCuts1 + k;
+            t->CutCount[1]++; 
             if ( !Mf_CutMergeOrder(pCut0, pCut1, pCutsR[nCutsR], nLutSize) )
                 continue;
             if ( Mf_SetLastCutIsContained(pCutsR, nCutsR) )
                 continue;
-            p->CutCount[2]++;
+            t->CutCount[2]++;
             if ( p->pPars->fCutMin && Mf_CutComputeTruth(p, pCut0, pCut1, fComp0, fComp1, pCutsR[nCutsR], fIsXor) )
                 pCutsR[nCutsR]->Sign = Mf_CutGetSign(pCutsR[nCutsR]->pLeaves, pCutsR[nCutsR]->nLeaves);
             Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
@@ -1114,12 +1164,12 @@ void Mf_ObjMergeOrder( Mf_Man_t * p, int iObj )
     // store the cutset
     pBest->Flow = pCutsR[0]->Flow;
     pBest->Delay = pCutsR[0]->Delay;
-    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    pBest->iCutSet = Mf_ManSaveCuts( p, t, pCutsR, nCutsR );
     // verify
     assert( nCutsR > 0 && nCutsR < nCutNum );
 //    assert( Mf_SetCheckArray(pCutsR, nCutsR) );
-    p->nCutCounts[pCutsR[0]->nLeaves]++;
-    p->CutCount[3] += nCutsR;
+    t->nCutCounts[pCutsR[0]->nLeaves]++;
+    t->CutCount[3] += nCutsR;
 }
  
 
@@ -1395,8 +1445,9 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pPars     = pPars;
     p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
-    p->iCur      = 2;
-    Vec_PtrGrow( &p->vPages, 256 );
+    p->nThreads  = (pPars->nProcNum > 1 && !pPars->fCutMin) ? Abc_MinInt(pPars->nProcNum, UTIL_PTH_MAX) : 1;
+    p->pThrs     = ABC_CALLOC( Mf_Thr_t, p->nThreads );
+    Vec_PtrFill( &p->vPages, (1<<15), NULL );
     if ( pPars->fGenCnf || pPars->fGenLit )
     {
         Vec_IntGrow( &p->vCnfSizes, 10000 );
@@ -1423,6 +1474,7 @@ void Mf_ManFree( Mf_Man_t * p )
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
     ABC_FREE( p->vTemp.pArray );
+    ABC_FREE( p->pThrs );
     ABC_FREE( p->pLfObjs );
     ABC_FREE( p );
 }
@@ -1462,6 +1514,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  MF_LEAF_MAX;
     pPars->nCutNumMax   =  MF_CUT_MAX;
+    pPars->nProcNumMax  =  UTIL_PTH_MAX;
 }
 void Mf_ManPrintStats( Mf_Man_t * p, char * pTitle )
 {
@@ -1490,6 +1543,8 @@ void Mf_ManPrintInit( Mf_Man_t * p )
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
     printf( "CNF = %d  ",     p->pPars->fGenCnf );
     printf( "FFL = %d  ",     p->pPars->fGenLit );
+    if ( p->nThreads > 1 )
+        printf( "Threads = %d  ", p->nThreads );
     printf( "\n" );
     printf( "Computing cuts...\r" );
     fflush( stdout );
@@ -1498,7 +1553,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
 {
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
-    float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
+    float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * p->nPages / (1<<20);
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
@@ -1528,11 +1583,36 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     }
     fflush( stdout );
 }
-void Mf_ManComputeCuts( Mf_Man_t * p )
+static void Mf_ManComputeCutsTask( void * pUser, int * pObjs, int nObjs, int iLevel, int iThread )
 {
+    Mf_Man_t * p = (Mf_Man_t *)pUser;
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+    for ( i = 0; i < nObjs; i++ )
+        Mf_ObjMergeOrder( p, p->pThrs + iThread, pObjs[i] );
+}
+void Mf_ManComputeCuts( Mf_Man_t * p )
+{
+    Mf_Thr_t * t;
+    int i, k;
+    if ( p->nThreads > 1 )
+    {
+        // the nodes of one level depend only on the cuts of the lower levels
+        Vec_Wec_t * vLevels = Gia_ManLevParCollect( p->pGia );
+        Gia_ManLevParRun( vLevels, p->nThreads, Mf_ManComputeCutsTask, NULL, p );
+        Vec_WecFree( vLevels );
+    }
+    else
+    {
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, p->pThrs, i );
+    }
+    for ( t = p->pThrs; t < p->pThrs + p->nThreads; t++ )
+    {
+        for ( k = 0; k < 4; k++ )
+            p->CutCount[k] += t->CutCount[k];
+        for ( k = 0; k <= MF_LEAF_MAX; k++ )
+            p->nCutCounts[k] += t->nCutCounts[k];
+    }
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1851,7 +1931,9 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         pNew = Mf_ManDeriveMappingCoarse( p );
     else
         pNew = Mf_ManDeriveMapping( p );
-    if ( p->pPars->fGenCnf )
+    if ( p->pPars->fGenCnf && p->pPars->pCnfFile )
+        Mf_ManWriteCnf( p, p->pPars->pCnfFile, p->pPars->fCnfObjIds, p->pPars->fAddOrCla );
+    else if ( p->pPars->fGenCnf )
         pGia->pData = Mf_ManDeriveCnf( p, p->pPars->fCnfObjIds, p->pPars->fAddOrCla );
     //if ( p->pPars->fGenCnf || p->pPars->fGenLit )
     //    Mf_ManProfileTruths( p );
@@ -1895,15 +1977,24 @@ void * Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fA
 void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int fVerbose )
 {
     abctime clk = Abc_Clock();
-    Cnf_Dat_t * pCnf;
-    pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, nLutSize, fCnfObjIds, fAddOrCla, 0, fVerbose );
-    Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
+    Gia_Man_t * pNew;
+    Jf_Par_t Pars, * pPars = &Pars;
+    assert( nLutSize >= 3 && nLutSize <= 8 );
+    Mf_ManSetDefaultPars( pPars );
+    pPars->fGenCnf     = 1;
+    pPars->fCoarsen    = !fCnfObjIds;
+    pPars->nLutSize    = nLutSize;
+    pPars->fCnfObjIds  = fCnfObjIds;
+    pPars->fAddOrCla   = fAddOrCla;
+    pPars->fVerbose    = fVerbose;
+    pPars->pCnfFile    = pFileName;
+    pNew = Mf_ManPerformMapping( p, pPars );
+    Gia_ManStopP( &pNew );
 //    if ( fVerbose )
     {
-        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+        printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pPars->nCnfVars, pPars->nCnfClauses, pPars->nCnfLiterals );
         Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     }
-    Cnf_DataFree(pCnf);
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -487,6 +487,68 @@ Gia_Man_t * Gia_ManAigSynch2( Gia_Man_t * pInit, void * pPars0, int nLutSize, in
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes structural choices without leaving GIA.]
+
+  Description [Derives three snapshots using GIA-based synthesis (the 
+  original AIG, area-oriented balancing, and mapping-based resynthesis, 
+  or DSD balancing if lighter synthesis is requested), proves equivalences
+  in their miter with the SAT sweeper from cecSatG2.c, and records the 
+  choices as siblings. The most optimized snapshot gives the primary 
+  structure, as in Dar_ManChoiceNew().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManPerformDchNative( Gia_Man_t * p, void * pPars0 )
+{
+    extern void Cec4_ManSimulateTest2( Gia_Man_t * p, int nConfs, int fVerbose );
+    Dch_Pars_t * pPars = (Dch_Pars_t *)pPars0;
+    Gia_Man_t * pGia1, * pGia2, * pGia3, * pNew, * pTemp;
+    Vec_Ptr_t * vGias;
+    abctime clk = Abc_Clock();
+    pGia1 = Gia_ManDup( p );
+    if ( Gia_ManAndNum(pGia1) == 0 )
+        return pGia1;
+    // derive the snapshots
+    pGia2 = Gia_ManAreaBalance( pGia1, 0, ABC_INFINITY, 0, 0 );
+    if ( pPars->fLightSynth )
+        pGia3 = Gia_ManPerformDsdBalance( pGia2, 6, 4, 0, 0 );
+    else
+        pGia3 = Gia_ManAigSyn2( pGia2, 0, 1, 0, 20, 0, 0, 0 );
+    pPars->timeSynth = Abc_Clock() - clk;
+    if ( pPars->fVerbose )
+    {
+        Gia_ManPrintStats( pGia2, NULL );
+        Gia_ManPrintStats( pGia3, NULL );
+        Abc_PrintTime( 1, "Synthesis time", pPars->timeSynth );
+    }
+    // derive the miter with the most optimized snapshot first
+    vGias = Vec_PtrAlloc( 3 );
+    Vec_PtrPush( vGias, pGia3 );
+    Vec_PtrPush( vGias, pGia2 );
+    Vec_PtrPush( vGias, pGia1 );
+    pTemp = Gia_ManChoiceMiter( vGias );
+    Vec_PtrFree( vGias );
+    Gia_ManStop( pGia1 );
+    Gia_ManStop( pGia2 );
+    Gia_ManStop( pGia3 );
+    // compute equivalences and record choices
+    Cec4_ManSimulateTest2( pTemp, pPars->nBTLimit, pPars->fVerbose );
+    pNew = Gia_ManEquivToChoices( pTemp, 3 );
+    Gia_ManStop( pTemp );
+    pNew = Gia_ManEquivToSibls( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    ABC_FREE( pNew->pName );
+    ABC_FREE( pNew->pSpec );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
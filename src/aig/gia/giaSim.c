@@ -171,6 +171,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
+    p->nThreads     =   1;    // the number of simulation threads
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
 }
@@ -346,12 +347,12 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
     int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
+    for ( w = wStop-1; w >= wStart; w-- )
         pInfo[w] = pInfo0[w];
 }
 
@@ -366,16 +367,16 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimDataCo( p, iCo );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     int w;
     if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = ~pInfo0[w];
     else 
-        for ( w = p->nWords-1; w >= 0; w-- )
+        for ( w = wStop-1; w >= wStart; w-- )
             pInfo[w] = pInfo0[w];
 }
 
@@ -390,7 +391,7 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int wStart, int wStop )
 {
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
@@ -399,19 +400,19 @@ static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
     if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = ~pInfo0[w] & pInfo1[w];
     }
     else 
     {
         if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & ~pInfo1[w];
         else 
-            for ( w = p->nWords-1; w >= 0; w-- )
+            for ( w = wStop-1; w >= wStart; w-- )
                 pInfo[w] = pInfo0[w] & pInfo1[w];
     }
 }
@@ -473,34 +474,44 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSimulateRound( Gia_ManSim_t * p )
+static void Gia_ManSimulateRoundRange( void * pUser, int * pObjs, int nObjs, int wStart, int wStop )
 {
+    Gia_ManSim_t * p = (Gia_ManSim_t *)pUser;
+    unsigned * pInfo = Gia_SimData( p, 0 );
     Gia_Obj_t * pObj;
-    int i, iCis = 0, iCos = 0;
-    assert( p->pAig->nFront > 0 );
-    assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
+    int i, w, iCis = 0, iCos = 0;
+    assert( pObjs == NULL );
+    for ( w = wStop-1; w >= wStart; w-- )
+        pInfo[w] = 0;
     Gia_ManForEachObj1( p->pAig, pObj, i )
     {
         if ( Gia_ObjIsAndOrConst0(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
+            Gia_ManSimulateNode( p, pObj, wStart, wStop );
         }
         else if ( Gia_ObjIsCo(pObj) )
         {
             assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
+            Gia_ManSimulateCo( p, iCos++, pObj, wStart, wStop );
         }
         else // if ( Gia_ObjIsCi(pObj) )
         {
             assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            Gia_ManSimulateCi( p, pObj, iCis++, wStart, wStop );
         }
     }
     assert( Gia_ManCiNum(p->pAig) == iCis );
     assert( Gia_ManCoNum(p->pAig) == iCos );
 }
+void Gia_ManSimulateRound( Gia_ManSim_t * p )
+{
+    assert( p->pAig->nFront > 0 );
+    assert( Gia_ManConst0(p->pAig)->Value == 0 );
+    // the frontier reuses memory in the topological order, so only
+    // the pattern words can be split among the threads
+    Gia_SimParRun( NULL, p->nWords, p->pPars->nThreads, Gia_ManSimulateRoundRange, p );
+}
 
 /**Function*************************************************************
 
@@ -90,22 +90,33 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
     Gia_ManForEachCiId( p, Id, i )
         memcpy( Vec_WrdEntryP(vSims, Id*nWords), Vec_WrdEntryP(vSimsIn, i*nWords), sizeof(word)*nWords );
 }
-static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+static inline void Gia_ManSimPatSimAndRange( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, int wStart, int wStop, Vec_Wrd_t * vSims )
 {
     word pComps[2] = { 0, ~(word)0 };
     word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
     word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
-    word * pSims  = Vec_WrdArray(vSims);
+    word * pSims  = Vec_WrdArray(vSims) + wStart;
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
+    word * pSims2 = pSims + nWords*i; int w, nSlice = wStop - wStart;
+    if ( nSlice >= GIA_SIMD_MIN )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            Gia_SimdXor( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nSlice );
+        else
+            Gia_SimdAnd( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nSlice );
+    }
+    else if ( Gia_ObjIsXor(pObj) )
+        for ( w = 0; w < nSlice; w++ )
             pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
     else
-        for ( w = 0; w < nWords; w++ )
+        for ( w = 0; w < nSlice; w++ )
             pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
 }
+static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_ManSimPatSimAndRange( p, i, pObj, nWords, 0, nWords, vSims );
+}
 static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
     word pComps[2] = { 0, ~(word)0 };
@@ -154,6 +165,65 @@ Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOut
     Vec_WrdFree( vSims );
     return vSimsCo;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded version of Gia_ManSimPatSimOut().]
+
+  Description [Returns the same simulation info. The words are split
+  among the threads or, if there are too few of them, the nodes of
+  each level are (see Gia_SimParRun).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_SimPatPar_t_ Gia_SimPatPar_t;
+struct Gia_SimPatPar_t_
+{
+    Gia_Man_t *    pGia;
+    Vec_Wrd_t *    vSims;
+    int            nWords;
+};
+static void Gia_ManSimPatSimParTask( void * pUser, int * pObjs, int nObjs, int wStart, int wStop )
+{
+    Gia_SimPatPar_t * p = (Gia_SimPatPar_t *)pUser;
+    Gia_Obj_t * pObj; int i;
+    if ( pObjs == NULL )
+    {
+        Gia_ManForEachAnd( p->pGia, pObj, i )
+            Gia_ManSimPatSimAndRange( p->pGia, i, pObj, p->nWords, wStart, wStop, p->vSims );
+        return;
+    }
+    for ( i = 0; i < nObjs; i++ )
+        Gia_ManSimPatSimAndRange( p->pGia, pObjs[i], Gia_ManObj(p->pGia, pObjs[i]), p->nWords, wStart, wStop, p->vSims );
+}
+Vec_Wrd_t * Gia_ManSimPatSimOutPar( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts, int nThreads )
+{
+    Gia_SimPatPar_t Data, * p = &Data;
+    Vec_Wec_t * vLevels;
+    Gia_Obj_t * pObj;
+    int i, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(pGia);
+    Vec_Wrd_t * vSimsCo = fOuts ? Vec_WrdStart( Gia_ManCoNum(pGia) * nWords ) : NULL;
+    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    assert( Vec_WrdSize(vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    Gia_ManSimPatAssignInputs( pGia, nWords, vSims, vSimsPi );
+    p->pGia   = pGia;
+    p->vSims  = vSims;
+    p->nWords = nWords;
+    vLevels = Gia_ManSimParLevels( pGia, nWords, nThreads );
+    Gia_SimParRun( vLevels, nWords, nThreads, Gia_ManSimPatSimParTask, p );
+    Vec_WecFreeP( &vLevels );
+    Gia_ManForEachCo( pGia, pObj, i )
+        Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+    if ( !fOuts )
+        return vSims;
+    Gia_ManForEachCo( pGia, pObj, i )
+        memcpy( Vec_WrdEntryP(vSimsCo, i*nWords), Vec_WrdEntryP(vSims, Gia_ObjId(pGia, pObj)*nWords), sizeof(word)*nWords );
+    Vec_WrdFree( vSims );
+    return vSimsCo;
+}
 static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims, Vec_Wrd_t * vSimsC )
 {
     word pComps[2] = { ~(word)0, 0 };
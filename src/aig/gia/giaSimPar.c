@@ -0,0 +1,296 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Multi-threaded levelized simulation and traversal.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaSimPar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_SIMPAR_WORDS    8   // the smallest word slice given to one thread
+#define GIA_SIMPAR_NODES 1024   // the smallest node chunk given to one thread
+#define GIA_LEVPAR_NODES   64   // the smallest node chunk in the levelized traversal
+
+typedef struct Gia_SimPar_t_ Gia_SimPar_t;
+struct Gia_SimPar_t_
+{
+    Gia_SimParTask_t pTask;     // the user's simulation procedure
+    void *           pUser;     // the user's data
+    int *            pObjs;     // the nodes of the current level
+    int              nObjs;     // the number of nodes of the current level
+    int              nChunk;    // the number of nodes in one task
+    int              nWords;    // the number of words
+    int              nSlice;    // the number of words in one task
+};
+
+typedef struct Gia_LevPar_t_ Gia_LevPar_t;
+struct Gia_LevPar_t_
+{
+    Gia_LevParTask_t pTask;     // the user's node procedure
+    Gia_LevParDone_t pDone;     // the user's level procedure (or NULL)
+    void *           pUser;     // the user's data
+    Vec_Wec_t *      vLevels;   // the nodes by level
+    Vec_Int_t *      vTasks;    // the level and the first node of each task
+    Vec_Int_t *      vStages;   // the first task of each non-empty level
+    int              nChunk;    // the largest number of nodes in one task
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Groups AND nodes by level for node-parallel simulation.]
+
+  Description [Returns NULL if there are enough words to split them
+  among the threads, or if the levels are too narrow on average to be
+  worth synchronizing on. In both cases, the simulation is partitioned
+  by words only.]
+
+  SideEffects [Computes the levels of the manager.]
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_ManSimParLevels( Gia_Man_t * p, int nWords, int nThreads )
+{
+    Vec_Wec_t * vLevels;
+    Gia_Obj_t * pObj;
+    int i, nLevels;
+    if ( nThreads <= 1 || nWords >= nThreads * GIA_SIMPAR_WORDS || Gia_ManAndNum(p) == 0 )
+        return NULL;
+    nLevels = Gia_ManLevelNum( p );
+    if ( Gia_ManAndNum(p) / Abc_MaxInt(nLevels, 1) < nThreads * GIA_SIMPAR_NODES )
+        return NULL;
+    vLevels = Vec_WecStart( nLevels + 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_WecPush( vLevels, Gia_ObjLevel(p, pObj), i );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Thread procedures.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimParWordTask( void * pArg, int iTask, int iThread )
+{
+    Gia_SimPar_t * p = (Gia_SimPar_t *)pArg;
+    int wStart = iTask * p->nSlice;
+    int wStop  = Abc_MinInt( wStart + p->nSlice, p->nWords );
+    p->pTask( p->pUser, NULL, 0, wStart, wStop );
+}
+static void Gia_SimParNodeTask( void * pArg, int iTask, int iThread )
+{
+    Gia_SimPar_t * p = (Gia_SimPar_t *)pArg;
+    int iStart = iTask * p->nChunk;
+    int iStop  = Abc_MinInt( iStart + p->nChunk, p->nObjs );
+    p->pTask( p->pUser, p->pObjs + iStart, iStop - iStart, 0, p->nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the simulation procedure on several threads.]
+
+  Description [The procedure is called either with pObjs equal to NULL,
+  in which case it should simulate all AND nodes in the topological
+  order for words [wStart, wStop), or with an array of nodes of one
+  level, which should be simulated for all words. The pattern words are
+  split among the threads when there are enough of them. Otherwise, if
+  vLevels is given (see Gia_ManSimParLevels), the nodes of each level
+  are split among the threads. The result does not depend on the number
+  of threads or on the partitioning.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimParRun( Vec_Wec_t * vLevels, int nWords, int nThreads, Gia_SimParTask_t pTask, void * pUser )
+{
+    Gia_SimPar_t Data, * p = &Data;
+    Vec_Int_t * vLevel;
+    int i, nTasks;
+    if ( nThreads <= 1 || !Util_PthEnabled() || nWords == 0 )
+    {
+        pTask( pUser, NULL, 0, 0, nWords );
+        return;
+    }
+    memset( p, 0, sizeof(Gia_SimPar_t) );
+    p->pTask  = pTask;
+    p->pUser  = pUser;
+    p->nWords = nWords;
+    if ( vLevels == NULL || nWords >= nThreads * GIA_SIMPAR_WORDS )
+    {
+        // split the words into slices aligned to the smallest slice
+        nTasks = Abc_MinInt( nThreads, nWords );
+        p->nSlice = (nWords + nTasks - 1) / nTasks;
+        if ( nWords >= nTasks * GIA_SIMPAR_WORDS )
+            p->nSlice = (p->nSlice + GIA_SIMPAR_WORDS - 1) / GIA_SIMPAR_WORDS * GIA_SIMPAR_WORDS;
+        nTasks = (nWords + p->nSlice - 1) / p->nSlice;
+        Util_PthRun( nThreads, nTasks, Gia_SimParWordTask, p );
+        return;
+    }
+    // simulate one level at a time, splitting wide levels into chunks
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        if ( Vec_IntSize(vLevel) < 2 * GIA_SIMPAR_NODES )
+        {
+            pTask( pUser, Vec_IntArray(vLevel), Vec_IntSize(vLevel), 0, nWords );
+            continue;
+        }
+        p->pObjs  = Vec_IntArray(vLevel);
+        p->nObjs  = Vec_IntSize(vLevel);
+        p->nChunk = Abc_MaxInt( GIA_SIMPAR_NODES, (p->nObjs + 4 * nThreads - 1) / (4 * nThreads) );
+        nTasks    = (p->nObjs + p->nChunk - 1) / p->nChunk;
+        Util_PthRun( nThreads, nTasks, Gia_SimParNodeTask, p );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Groups AND nodes by level for the levelized traversal.]
+
+  Description [The level of a node is larger than the levels of its 
+  fanins, including the data input of a MUX, and the level of its next 
+  choice node. Thus, when the nodes are visited one level at a time, the 
+  fanins and the choices of a node are visited before the node. The 
+  nodes of each level are listed in the increasing order of IDs. Level 0 
+  is empty. Does not change the levels stored in the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Gia_ManLevParCollect( Gia_Man_t * p )
+{
+    Vec_Wec_t * vLevels = Vec_WecStart( 1 );
+    Vec_Int_t * vLevel = Vec_IntStart( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj;
+    int i, Level;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevel, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevel, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(p, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjFaninId2(p, i)) );
+        if ( Gia_ObjSibl(p, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Gia_ObjSibl(p, i)) );
+        Vec_IntWriteEntry( vLevel, i, ++Level );
+        if ( Level == Vec_WecSize(vLevels) )
+            Vec_WecPushLevel( vLevels );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the node procedure on several threads level by level.]
+
+  Description [The nodes of each level (see Gia_ManLevParCollect) are 
+  split into chunks, which are handed out to the threads. A level is 
+  started only after all chunks of the previous levels are completed. 
+  The procedure gets the chunk, its level, and the thread number, which 
+  can be used to select per-thread scratch data. The threads are 
+  created once for the whole traversal. The level procedure, if given, 
+  is called after each level is completed, while no chunk is processed. 
+  With one thread, the levels are visited in order on the calling thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_LevParTask( void * pArg, int iTask, int iThread )
+{
+    Gia_LevPar_t * p = (Gia_LevPar_t *)pArg;
+    int iLevel = Vec_IntEntry( p->vTasks, 2*iTask );
+    int iStart = Vec_IntEntry( p->vTasks, 2*iTask+1 );
+    Vec_Int_t * vLevel = Vec_WecEntry( p->vLevels, iLevel );
+    int iStop  = Abc_MinInt( iStart + p->nChunk, Vec_IntSize(vLevel) );
+    p->pTask( p->pUser, Vec_IntArray(vLevel) + iStart, iStop - iStart, iLevel, iThread );
+}
+static void Gia_LevParStage( void * pArg, int iStage )
+{
+    Gia_LevPar_t * p = (Gia_LevPar_t *)pArg;
+    int iTask = Vec_IntEntry( p->vStages, iStage );
+    p->pDone( p->pUser, Vec_IntEntry(p->vTasks, 2*iTask) );
+}
+void Gia_ManLevParRun( Vec_Wec_t * vLevels, int nThreads, Gia_LevParTask_t pTask, Gia_LevParDone_t pDone, void * pUser )
+{
+    Gia_LevPar_t Data, * p = &Data;
+    Vec_Int_t * vLevel, * vStages;
+    int i, k;
+    if ( nThreads <= 1 || !Util_PthEnabled() )
+    {
+        Vec_WecForEachLevel( vLevels, vLevel, i )
+            if ( Vec_IntSize(vLevel) )
+            {
+                pTask( pUser, Vec_IntArray(vLevel), Vec_IntSize(vLevel), i, 0 );
+                if ( pDone )
+                    pDone( pUser, i );
+            }
+        return;
+    }
+    memset( p, 0, sizeof(Gia_LevPar_t) );
+    p->pTask   = pTask;
+    p->pDone   = pDone;
+    p->pUser   = pUser;
+    p->vLevels = vLevels;
+    p->vTasks  = Vec_IntAlloc( 1000 );
+    // one chunk size for all levels; the narrow levels become single tasks
+    p->nChunk  = Abc_MaxInt( GIA_LEVPAR_NODES, Vec_WecSizeSize(vLevels) / Abc_MaxInt(1, Vec_WecSize(vLevels)) / (4 * nThreads) );
+    vStages    = Vec_IntAlloc( 1000 );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        Vec_IntPush( vStages, Vec_IntSize(p->vTasks) / 2 );
+        for ( k = 0; k < Vec_IntSize(vLevel); k += p->nChunk )
+            Vec_IntPushTwo( p->vTasks, i, k );
+    }
+    Vec_IntPush( vStages, Vec_IntSize(p->vTasks) / 2 );
+    p->vStages = vStages;
+    Util_PthRunStages( nThreads, Vec_IntSize(vStages) - 1, Vec_IntArray(vStages), Gia_LevParTask, pDone ? Gia_LevParStage : NULL, p );
+    Vec_IntFree( vStages );
+    Vec_IntFree( p->vTasks );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,314 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Word-parallel simulation kernels using SIMD instructions.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaSimd.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_NO_SIMD)
+#define GIA_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the kernel computing an AND (or XOR) of two complemented simulation vectors
+typedef void (*Gia_SimdKernel_t)( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords );
+
+static char * s_SimdNames[GIA_SIMD_NUM] = { "scalar", "AVX2", "AVX-512" };
+static int    s_SimdWords[GIA_SIMD_NUM] = { 1, 4, 8 };
+static int    s_SimdMode = -1;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimdAndScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static void Gia_SimdXorScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 and AVX-512 kernels.]
+
+  Description [These are compiled for the target instruction set using
+  function attributes, so the rest of the code does not require special
+  compiler flags. They are called only if the CPU supports them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef GIA_SIMD_X86
+
+__attribute__((target("avx2")))
+static void Gia_SimdAndAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i Mask1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i In0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i const *)(pIn0 + w)), Mask0 );
+        __m256i In1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i const *)(pIn1 + w)), Mask1 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(In0, In1) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx2")))
+static void Gia_SimdXorAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i Mask = _mm256_set1_epi64x( (long long)(Diff0 ^ Diff1) );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i In0 = _mm256_loadu_si256( (__m256i const *)(pIn0 + w) );
+        __m256i In1 = _mm256_loadu_si256( (__m256i const *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(In0, In1), Mask) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+
+__attribute__((target("avx512f")))
+static void Gia_SimdAndAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i Mask0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i Mask1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i In0 = _mm512_xor_si512( _mm512_loadu_si512((void const *)(pIn0 + w)), Mask0 );
+        __m512i In1 = _mm512_xor_si512( _mm512_loadu_si512((void const *)(pIn1 + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(In0, In1) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx512f")))
+static void Gia_SimdXorAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i Mask = _mm512_set1_epi64( (long long)(Diff0 ^ Diff1) );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i In0 = _mm512_loadu_si512( (void const *)(pIn0 + w) );
+        __m512i In1 = _mm512_loadu_si512( (void const *)(pIn1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_xor_si512(In0, In1), Mask) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+
+static Gia_SimdKernel_t s_SimdAnd[GIA_SIMD_NUM] = { Gia_SimdAndScalar, Gia_SimdAndAvx2, Gia_SimdAndAvx512 };
+static Gia_SimdKernel_t s_SimdXor[GIA_SIMD_NUM] = { Gia_SimdXorScalar, Gia_SimdXorAvx2, Gia_SimdXorAvx512 };
+
+#else
+
+static Gia_SimdKernel_t s_SimdAnd[GIA_SIMD_NUM] = { Gia_SimdAndScalar, Gia_SimdAndScalar, Gia_SimdAndScalar };
+static Gia_SimdKernel_t s_SimdXor[GIA_SIMD_NUM] = { Gia_SimdXorScalar, Gia_SimdXorScalar, Gia_SimdXorScalar };
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the best kernel supported by the CPU.]
+
+  Description [Uses CPUID through the compiler built-ins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimdDetect()
+{
+#ifdef GIA_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return GIA_SIMD_AVX512;
+    if ( __builtin_cpu_supports("avx2") )
+        return GIA_SIMD_AVX2;
+#endif
+    return GIA_SIMD_SCALAR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernel used for simulation.]
+
+  Description [Mode -1 selects the best kernel supported by the CPU.
+  A mode not supported by the CPU is reduced to the best supported one.
+  Returns the selected mode.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimdSetMode( int Mode )
+{
+    int Best = Gia_SimdDetect();
+    s_SimdMode = (Mode < 0 || Mode > Best) ? Best : Mode;
+    return s_SimdMode;
+}
+int Gia_SimdMode()
+{
+    if ( s_SimdMode == -1 )
+        Gia_SimdSetMode( -1 );
+    return s_SimdMode;
+}
+char * Gia_SimdName( int Mode )
+{
+    assert( Mode >= 0 && Mode < GIA_SIMD_NUM );
+    return s_SimdNames[Mode];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rounds the number of words up to the vector width.]
+
+  Description [When the number of simulation words is a multiple of the
+  vector width, the kernels never fall back to the scalar tail loop.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SimdPadWords( int nWords )
+{
+    int nVec = s_SimdWords[Gia_SimdMode()];
+    return (nWords + nVec - 1) / nVec * nVec;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one AND or XOR node.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SimdAnd( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    s_SimdAnd[Gia_SimdMode()]( pOut, pIn0, pIn1, fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, nWords );
+}
+void Gia_SimdXor( word * pOut, word * pIn0, word * pIn1, int fCompl0, int fCompl1, int nWords )
+{
+    s_SimdXor[Gia_SimdMode()]( pOut, pIn0, pIn1, fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the simulation speed of the kernels.]
+
+  Description [Simulates the AIG with random patterns using each kernel
+  supported by the CPU and reports the number of patterns per second.
+  If nThreads is more than one, also runs the multi-threaded simulator
+  with the best kernel.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimdBench( Gia_Man_t * p, int nWords, int nIters, int nThreads, int fVerbose )
+{
+    Vec_Wrd_t * vSimsPi, * vSims = NULL, * vSims0 = NULL;
+    int i, Mode, ModeOld = Gia_SimdMode(), Best = Gia_SimdDetect();
+    int nModes = Best + 1 + (nThreads > 1);
+    char Buffer[16];
+    abctime clk, clkScalar = 0;
+    assert( nIters > 0 );
+    Abc_Random(1);
+    vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(p) * nWords );
+    printf( "Nodes = %d.  Words = %d.  Patterns = %d.  Iterations = %d.  Best kernel = %s.\n",
+        Gia_ManAndNum(p), nWords, 64 * nWords, nIters, Gia_SimdName(Best) );
+    for ( Mode = GIA_SIMD_SCALAR; Mode < nModes; Mode++ )
+    {
+        Gia_SimdSetMode( Abc_MinInt(Mode, Best) );
+        clk = Abc_Clock();
+        for ( i = 0; i < nIters; i++ )
+        {
+            if ( Mode > Best )
+                vSims = Gia_ManSimPatSimOutPar( p, vSimsPi, 0, nThreads );
+            else
+                vSims = Gia_ManSimPatSimOut( p, vSimsPi, 0 );
+            if ( i < nIters - 1 )
+                Vec_WrdFree( vSims );
+        }
+        clk = Abc_Clock() - clk;
+        if ( Mode == GIA_SIMD_SCALAR )
+            clkScalar = clk, vSims0 = vSims;
+        else
+        {
+            if ( !Vec_WrdEqual(vSims0, vSims) )
+                printf( "Error: The %s kernel produced different simulation values.\n", Gia_SimdName(Abc_MinInt(Mode, Best)) );
+            Vec_WrdFree( vSims );
+        }
+        if ( Mode > Best )
+            sprintf( Buffer, "%d thr", nThreads );
+        printf( "%-8s : ", Mode > Best ? Buffer : Gia_SimdName(Mode) );
+        printf( "%10.2f Kpatterns/sec  ", clk ? 64.0 * nWords * nIters / 1000 / (1.0 * clk / CLOCKS_PER_SEC) : 0.0 );
+        printf( "%10.2f Gnode-patterns/sec  ", clk ? 64.0 * nWords * nIters * Gia_ManAndNum(p) / 1000000000 / (1.0 * clk / CLOCKS_PER_SEC) : 0.0 );
+        printf( "Gain = %5.2f  ", clk ? 1.0 * clkScalar / clk : 0.0 );
+        ABC_PRT( "Time", clk );
+    }
+    Gia_SimdSetMode( ModeOld );
+    Vec_WrdFreeP( &vSims0 );
+    Vec_WrdFree( vSimsPi );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
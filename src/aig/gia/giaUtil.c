@@ -3092,9 +3092,9 @@ void Gia_ManWriteSol( Gia_Man_t * p, char * pFileName )
     {
         Gia_Obj_t * pObj; int i;
         Gia_ManForEachAnd( p, pObj, i )
-            fprintf( pFile, "%d %d ", Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i) );
+            fprintf( pFile, "%d %d ", (int)Gia_ObjFaninLit0(pObj, i), (int)Gia_ObjFaninLit1(pObj, i) );
         Gia_ManForEachCo( p, pObj, i )
-            fprintf( pFile, "%d %d ", Gia_ObjFaninLit0p(p, pObj), Gia_ObjFaninLit0p(p, pObj) );
+            fprintf( pFile, "%d %d ", (int)Gia_ObjFaninLit0p(p, pObj), (int)Gia_ObjFaninLit0p(p, pObj) );
         fclose( pFile );   
         printf( "Finished writing solution file \"%s\".\n", pFileName2 );
     }
@@ -3153,10 +3153,10 @@ void Gia_ManPrintArray( Gia_Man_t * p )
         printf( "0, 0,  " );
     printf( "\n    " );
     Gia_ManForEachAnd( p, pObj, i )
-        printf( "%d, %d,  ", Gia_ObjFaninLit0p(p, pObj), Gia_ObjFaninLit1p(p, pObj) );
+        printf( "%d, %d,  ", (int)Gia_ObjFaninLit0p(p, pObj), (int)Gia_ObjFaninLit1p(p, pObj) );
     printf( "\n    " );
     Gia_ManForEachCo( p, pObj, i )
-        printf( "%d, %d,  ", Gia_ObjFaninLit0p(p, pObj), Gia_ObjFaninLit0p(p, pObj) );
+        printf( "%d, %d,  ", (int)Gia_ObjFaninLit0p(p, pObj), (int)Gia_ObjFaninLit0p(p, pObj) );
     printf( "\n" );
     printf( "};\n" );
 
@@ -1558,12 +1558,14 @@ Abc_Ntk_t * Abc_NtkDRewrite( Abc_Ntk_t * pNtk, Dar_RwrPar_t * pPars )
         Vec_VecFree( vParts );
     }
 */
-    Dar_ManRewrite( pMan, pPars );
-//    pMan = Dar_ManBalance( pTemp = pMan, pPars->fUpdateLevel );
-//    Aig_ManStop( pTemp );
-
 clk = Abc_Clock();
-    pMan = Aig_ManDupDfs( pTemp = pMan ); 
+    if ( pPars->nThreads > 1 )
+        pMan = Dar_ManRewritePar( pTemp = pMan, pPars );
+    else
+    {
+        Dar_ManRewrite( pMan, pPars );
+        pMan = Aig_ManDupDfs( pTemp = pMan ); 
+    }
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
@@ -1621,7 +1623,7 @@ clk = Abc_Clock();
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose )
 {
     Aig_Man_t * pMan, * pTemp;
     Abc_Ntk_t * pNtkAig;
@@ -1633,7 +1635,7 @@ Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fF
 //    Aig_ManPrintStats( pMan );
 
 clk = Abc_Clock();
-    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
+    pMan = Dar_ManCompress2Par( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, nThreads, fVerbose ); 
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
@@ -1845,6 +1847,7 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
 //    Cnf_Man_t * pManCnf = NULL;
     Cnf_Dat_t * pCnf;
     Abc_Ntk_t * pNtkNew = NULL;
+    int nVars, nClauses, nLiterals;
     abctime clk = Abc_Clock();
     assert( Abc_NtkIsStrash(pNtk) );
 
@@ -1862,11 +1865,21 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     if ( fVerbose )
     Aig_ManPrintStats( pMan );
 
+    // write CNF into a file as it is generated
+    if ( !fFastAlgo )
+    {
+        if ( Cnf_DeriveIntoFile( pMan, 0, pFileName, fChangePol, &nVars, &nClauses, &nLiterals ) )
+        {
+            Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.   ", nVars, nClauses, nLiterals );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        Cnf_ManFree();
+        Aig_ManStop( pMan );
+        return NULL;
+    }
+
     // derive CNF
-    if ( fFastAlgo )
-        pCnf = Cnf_DeriveFast( pMan, 0 );
-    else
-        pCnf = Cnf_Derive( pMan, 0 );
+    pCnf = Cnf_DeriveFast( pMan, 0 );
 
     // adjust polarity
     if ( fChangePol )
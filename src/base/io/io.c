@@ -2233,7 +2233,7 @@ usage:
     fprintf( pAbc->Err, "\t-c     : toggle adjasting polarity of internal variables [default = %s]\n", fChangePol? "yes" : "no" );
     fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
-    fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of the file to write (compressed if it ends in \".gz\")\n" );
     return 1;
 }
 
@@ -2337,7 +2337,7 @@ usage:
     fprintf( pAbc->Err, "\t-o       : toggle adding OR clause for the outputs [default = %s]\n", fAddOrCla? "yes" : "no" );
     fprintf( pAbc->Err, "\t-v       : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
     fprintf( pAbc->Err, "\t-h       : print the help massage\n" );
-    fprintf( pAbc->Err, "\tfile     : the name of the file to write\n" );
+    fprintf( pAbc->Err, "\tfile     : the name of the file to write (compressed if it ends in \".gz\")\n" );
     fprintf( pAbc->Err, "\n" );
     fprintf( pAbc->Err, "\t           CNF variable mapping rules:\n" );
     fprintf( pAbc->Err, "\n" );
@@ -23,6 +23,7 @@
 #include "bool/dec/dec.h"
 #include "map/if/if.h"
 #include "aig/miniaig/ndr.h"
+#include "sat/bmc/bmc.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -66,6 +67,7 @@ void *      Abc_FrameReadManDd()                             { if ( s_GlobalFram
 void *      Abc_FrameReadManDec()                            { if ( s_GlobalFrame->pManDec == NULL ) s_GlobalFrame->pManDec = Dec_ManStart();                                        return s_GlobalFrame->pManDec; } 
 void *      Abc_FrameReadManDsd()                            { return s_GlobalFrame->pManDsd;      } 
 void *      Abc_FrameReadManDsd2()                           { return s_GlobalFrame->pManDsd2;     }
+void *      Abc_FrameReadManBmc()                            { return s_GlobalFrame->pManBmc;      }
 char *      Abc_FrameReadFlag( char * pFlag )                { return Cmd_FlagReadByName( s_GlobalFrame, pFlag );   }
 Vec_Ptr_t * Abc_FrameReadSignalNames()                       { return s_GlobalFrame->vSignalNames; }
 char *      Abc_FrameReadSpecName()                          { return s_GlobalFrame->pSpecName;    }
@@ -101,6 +103,7 @@ void        Abc_FrameSetNFrames( int nFrames )               { ABC_FREE( s_Globa
 void        Abc_FrameSetStatus( int Status )                 { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->Status = Status;   }
 void        Abc_FrameSetManDsd( void * pMan )                { if (s_GlobalFrame->pManDsd  && s_GlobalFrame->pManDsd  != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd,  0); s_GlobalFrame->pManDsd = pMan;  }
 void        Abc_FrameSetManDsd2( void * pMan )               { if (s_GlobalFrame->pManDsd2 && s_GlobalFrame->pManDsd2 != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd2, 0); s_GlobalFrame->pManDsd2 = pMan; }
+void        Abc_FrameSetManBmc( void * pMan )                { if (s_GlobalFrame->pManBmc  && s_GlobalFrame->pManBmc  != pMan) Bmc_IncManStop((Bmc_IncMan_t *)s_GlobalFrame->pManBmc); s_GlobalFrame->pManBmc = pMan;  }
 void        Abc_FrameSetInv( Vec_Int_t * vInv )              { Vec_IntFreeP(&s_GlobalFrame->pAbcWlcInv); s_GlobalFrame->pAbcWlcInv = vInv; }
 void        Abc_FrameSetJsonStrs( Abc_Nam_t * pStrs )        { Abc_NamDeref( s_GlobalFrame->pJsonStrs ); s_GlobalFrame->pJsonStrs = pStrs; }
 void        Abc_FrameSetJsonObjs( Vec_Wec_t * vObjs )        { Vec_WecFreeP(&s_GlobalFrame->vJsonObjs ); s_GlobalFrame->vJsonObjs = vObjs; }
@@ -225,6 +228,7 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     if ( p->pSave4    )  Aig_ManStop( (Aig_Man_t *)p->pSave4 );
     if ( p->pManDsd   )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd, 0 );
     if ( p->pManDsd2  )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd2, 0 );
+    if ( p->pManBmc   )  Bmc_IncManStop( (Bmc_IncMan_t *)p->pManBmc );
     if ( p->pNtkBackup)  Abc_NtkDelete( p->pNtkBackup );
     if ( p->vPlugInComBinPairs ) 
     {
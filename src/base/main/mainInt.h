@@ -96,6 +96,7 @@ struct Abc_Frame_t_
     void *          pManDec;       // decomposition manager
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
+    void *          pManBmc;       // the incremental BMC session
     // libraries for mapping
     void *          pLibLut;       // the current LUT library
     void *          pLibBox;       // the current box library
@@ -211,6 +211,7 @@ struct Wlc_BstPar_t_
     int                    nOutputRange;
     int                    nAdderLimit;
     int                    nMultLimit;
+    int                    nThreads;
     int                    fGiaSimple;
     int                    fAddOutputs;
     int                    fMulti;
@@ -234,6 +235,7 @@ static inline void Wlc_BstParDefault( Wlc_BstPar_t * pPar )
     pPar->nOutputRange =  0;
     pPar->nAdderLimit  =  0;
     pPar->nMultLimit   =  0;
+    pPar->nThreads     =  1;
     pPar->fGiaSimple   =  0;
     pPar->fAddOutputs  =  0;
     pPar->fMulti       =  0;
@@ -1207,6 +1207,183 @@ void Wlc_BlastBooth( Gia_Man_t * pNew, int * pArgA, int * pArgB, int nArgA, int
     Vec_IntFree( vArgB );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts one arithmetic operator with many AND gates.]
+
+  Description [Handles multipliers, dividers, power, square root, and
+  square. The fanin bits are given in pFans0 and pFans1. The result is
+  returned in vRes. This procedure uses only the manager pNew and the
+  vectors passed to it, so several operators can be blasted in parallel 
+  into different managers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Wlc_BlastIsArith( int Type )
+{
+    return Type == WLC_OBJ_ARI_MULTI  || Type == WLC_OBJ_ARI_DIVIDE || Type == WLC_OBJ_ARI_REM    || 
+           Type == WLC_OBJ_ARI_MODULUS|| Type == WLC_OBJ_ARI_POWER  || Type == WLC_OBJ_ARI_SQRT   || 
+           Type == WLC_OBJ_ARI_SQUARE;
+}
+void Wlc_BlastArith( Gia_Man_t * pNew, Wlc_Ntk_t * p, Wlc_Obj_t * pObj, int * pFans0, int * pFans1, Vec_Int_t * vTemp0, Vec_Int_t * vTemp1, Vec_Int_t * vTemp2, Vec_Int_t * vRes, Wlc_BstPar_t * pPar )
+{
+    int nRange  = Wlc_ObjRange( pObj );
+    int nRange0 = Wlc_ObjFaninNum(pObj) > 0 ? Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) ) : -1;
+    int nRange1 = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjRange( Wlc_ObjFanin1(p, pObj) ) : -1;
+    Vec_IntClear( vRes );
+    if ( pObj->Type == WLC_OBJ_ARI_MULTI )
+    {
+        int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
+        int nRangeMax = Abc_MaxInt(nRange0, nRange1);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
+        if ( Wlc_NtkCountConstBits(pArg0, nRangeMax) < Wlc_NtkCountConstBits(pArg1, nRangeMax) )
+            ABC_SWAP( int *, pArg0, pArg1 );
+        if ( pPar->fBooth )
+            Wlc_BlastBooth( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL );
+        else if ( pPar->fCla )
+            Wlc_BlastMultiplier3( pNew, pArg0, pArg1, nRange0, nRange1, vRes, Wlc_ObjIsSignedFanin01(p, pObj), pPar->fCla, NULL );
+        else
+            Wlc_BlastMultiplier( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
+            //Wlc_BlastMultiplierC( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, fSigned ? Vec_IntEntryLast(vRes) : 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+        assert( Vec_IntSize(vRes) == nRange );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_DIVIDE || pObj->Type == WLC_OBJ_ARI_REM || pObj->Type == WLC_OBJ_ARI_MODULUS )
+    {
+        int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
+        int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
+        if ( fSigned )
+            Wlc_BlastDividerSigned( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+        else
+            Wlc_BlastDividerTop( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+        Vec_IntShrink( vRes, nRange );
+        if ( !pPar->fDivBy0 )
+            Wlc_BlastZeroCondition( pNew, pFans1, nRange1, vRes );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_POWER )
+    {
+        int nRangeMax = Abc_MaxInt(nRange0, nRange);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin0(p, pObj) );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRange1, Wlc_ObjIsSignedFanin1(p, pObj) );
+        Wlc_BlastPower( pNew, pArg0, nRangeMax, pArg1, nRange1, vTemp2, vRes );
+        Vec_IntShrink( vRes, nRange );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_SQRT )
+    {
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0 + (nRange0 & 1), 0 );
+        nRange0 += (nRange0 & 1);
+        if ( pPar->fNonRest )
+            Wlc_BlastSqrtNR( pNew, pArg0, nRange0, vTemp2, vRes );
+        else
+            Wlc_BlastSqrt( pNew, pArg0, nRange0, vTemp2, vRes );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_SQUARE )
+    {
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
+        Wlc_BlastSquare( pNew, pArg0, nRange0, vTemp2, vRes );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+    }
+    else assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts large arithmetic operators in parallel.]
+
+  Description [Each operator is blasted into its own shard whose CIs 
+  stand for the fanin bits. The main loop of Wlc_NtkBitBlast() merges the 
+  shards in the topological order. A shard is merged only if its logic is 
+  the same as blasting the operator directly on the actual fanin bits (see 
+  Gia_ManShardAppend); otherwise, the operator is blasted in the main loop. 
+  As a result, the AIG is identical to the one produced with one thread. 
+  Operators whose fanins are constants are always left to the main loop.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Wlc_BstShard_t_ Wlc_BstShard_t;
+struct Wlc_BstShard_t_
+{
+    Wlc_Ntk_t *      p;
+    Wlc_BstPar_t *   pPar;
+    Vec_Int_t *      vObjs;
+};
+static void Wlc_BlastShard( Gia_Man_t * pNew, void * pUser, int iTask )
+{
+    Wlc_BstShard_t * pMan = (Wlc_BstShard_t *)pUser;
+    Wlc_Obj_t * pObj = Wlc_NtkObj( pMan->p, Vec_IntEntry(pMan->vObjs, iTask) );
+    int nRange0 = Wlc_ObjRange( Wlc_ObjFanin0(pMan->p, pObj) );
+    int nRange1 = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjRange( Wlc_ObjFanin1(pMan->p, pObj) ) : 0;
+    Vec_Int_t * vFans  = Vec_IntAlloc( nRange0 + nRange1 );
+    Vec_Int_t * vTemp0 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTemp1 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTemp2 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vRes   = Vec_IntAlloc( 1000 );
+    int i, iLit;
+    for ( i = 0; i < nRange0 + nRange1; i++ )
+        Vec_IntPush( vFans, Gia_ManAppendCi(pNew) );
+    Wlc_BlastArith( pNew, pMan->p, pObj, Vec_IntArray(vFans), Vec_IntArray(vFans) + nRange0, vTemp0, vTemp1, vTemp2, vRes, pMan->pPar );
+    Vec_IntForEachEntry( vRes, iLit, i )
+        Gia_ManAppendCo( pNew, iLit );
+    Vec_IntFree( vFans );
+    Vec_IntFree( vTemp0 );
+    Vec_IntFree( vTemp1 );
+    Vec_IntFree( vTemp2 );
+    Vec_IntFree( vRes );
+}
+Vec_Ptr_t * Wlc_NtkBitBlastShards( Wlc_Ntk_t * p, Wlc_BstPar_t * pPar, Vec_Int_t * vShardIds )
+{
+    Wlc_BstShard_t Man, * pMan = &Man;
+    Vec_Ptr_t * vShards;
+    Wlc_Obj_t * pObj;
+    int i, k, iFanin;
+    abctime clk = Abc_Clock();
+    pMan->p     = p;
+    pMan->pPar  = pPar;
+    pMan->vObjs = Vec_IntAlloc( 100 );
+    Vec_IntFill( vShardIds, Wlc_NtkObjNumMax(p), -1 );
+    Wlc_NtkForEachObj( p, pObj, i )
+    {
+        if ( !Wlc_BlastIsArith(pObj->Type) || (pPar->vBoxIds && pObj->Mark) )
+            continue;
+        if ( Wlc_ObjRange(Wlc_ObjFanin0(p, pObj)) < 8 )
+            continue;
+        Wlc_ObjForEachFanin( pObj, iFanin, k )
+            if ( Wlc_NtkObj(p, iFanin)->Type == WLC_OBJ_CONST )
+                break;
+        if ( k < Wlc_ObjFaninNum(pObj) )
+            continue;
+        Vec_IntWriteEntry( vShardIds, i, Vec_IntSize(pMan->vObjs) );
+        Vec_IntPush( pMan->vObjs, i );
+    }
+    vShards = Gia_ManShardBuild( Vec_IntSize(pMan->vObjs), pPar->nThreads, pPar->fGiaSimple, Wlc_BlastShard, pMan );
+    if ( pPar->fVerbose )
+    {
+        printf( "Blasted %d arithmetic operators using %d threads.  ", Vec_IntSize(pMan->vObjs), pPar->nThreads );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_IntFree( pMan->vObjs );
+    return vShards;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1228,6 +1405,8 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     Vec_Ptr_t * vTables = NULL;
     Vec_Int_t * vFf2Ci = Vec_IntAlloc( 100 );
     Vec_Int_t * vRegClasses = NULL;
+    Vec_Int_t * vShardIds = NULL;
+    Vec_Ptr_t * vShards = NULL;
     Gia_Man_t * pTemp, * pNew, * pExtra = NULL;
     Wlc_Obj_t * pObj, * pObj2;
     Vec_Int_t * vBits = &p->vBits, * vTemp0, * vTemp1, * vTemp2, * vRes, * vAddOutputs = NULL, * vAddObjs = NULL;
@@ -1235,7 +1414,7 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     int nRange, nRange0, nRange1, nRange2, nRange3;
     int i, k, b, iFanin, iLit, nAndPrev, * pFans0, * pFans1, * pFans2, * pFans3;
     int nFFins = 0, nFFouts = 0, curPi = 0, curPo = 0, nFf2Regs = 0;
-    int nBitCis = 0, nBitCos = 0, fAdded = 0;
+    int nBitCis = 0, nBitCos = 0, fAdded = 0, nShardsMerged = 0;
     Wlc_BstPar_t Par, * pPar = &Par;
     Wlc_BstParDefault( pPar );
     pPar = pParIn ? pParIn : pPar;
@@ -1350,6 +1529,13 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     }
     //printf( "Init state: %s\n", p->pInits );
 
+    // blast large arithmetic operators in parallel
+    if ( pPar->nThreads > 1 )
+    {
+        vShardIds = Vec_IntAlloc( Wlc_NtkObjNumMax(p) );
+        vShards = Wlc_NtkBitBlastShards( p, pPar, vShardIds );
+    }
+
     // blast in the topological order
     Wlc_NtkForEachObj( p, pObj, i )
     {
@@ -1813,51 +1999,33 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
             for ( j = 0; j < nRange; j++ )
                 Vec_IntPush( vRes, Gia_ManHashMux(pNew, ModeIn, pArg0[j], pArg1[j]) ); 
         }
-        else if ( pObj->Type == WLC_OBJ_ARI_MULTI )
-        {
-            if ( fUseOldMultiplierBlasting )
-            {
-                int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
-                int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
-                int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
-                Wlc_BlastMultiplier2( pNew, pArg0, pArg1, nRange, vTemp2, vRes );
-                Vec_IntShrink( vRes, nRange );
-            }
-            else
-            {
-                int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
-                int nRangeMax = Abc_MaxInt(nRange0, nRange1);
-                int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
-                int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
-                if ( Wlc_NtkCountConstBits(pArg0, nRangeMax) < Wlc_NtkCountConstBits(pArg1, nRangeMax) )
-                    ABC_SWAP( int *, pArg0, pArg1 );
-                if ( pPar->fBooth )
-                    Wlc_BlastBooth( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL );
-                else if ( pPar->fCla )
-                    Wlc_BlastMultiplier3( pNew, pArg0, pArg1, nRange0, nRange1, vRes, Wlc_ObjIsSignedFanin01(p, pObj), pPar->fCla, NULL );
-                else
-                    Wlc_BlastMultiplier( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
-                    //Wlc_BlastMultiplierC( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
-                if ( nRange > Vec_IntSize(vRes) )
-                    Vec_IntFillExtra( vRes, nRange, fSigned ? Vec_IntEntryLast(vRes) : 0 );
-                else
-                    Vec_IntShrink( vRes, nRange );
-                assert( Vec_IntSize(vRes) == nRange );
-            }
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_DIVIDE || pObj->Type == WLC_OBJ_ARI_REM || pObj->Type == WLC_OBJ_ARI_MODULUS )
+        else if ( pObj->Type == WLC_OBJ_ARI_MULTI && fUseOldMultiplierBlasting )
         {
             int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
-            int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
-            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
-            if ( fSigned )
-                Wlc_BlastDividerSigned( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
-            else
-                Wlc_BlastDividerTop( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
+            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, Wlc_ObjIsSignedFanin01(p, pObj) );
+            Wlc_BlastMultiplier2( pNew, pArg0, pArg1, nRange, vTemp2, vRes );
             Vec_IntShrink( vRes, nRange );
-            if ( !pPar->fDivBy0 )
-                Wlc_BlastZeroCondition( pNew, pFans1, nRange1, vRes );
+        }
+        else if ( Wlc_BlastIsArith(pObj->Type) )
+        {
+            // use the shard if it gives the same logic as blasting the operator here
+            int fMerged = 0;
+            if ( vShards && Vec_IntEntry(vShardIds, i) >= 0 )
+            {
+                Gia_Man_t * pShard = (Gia_Man_t *)Vec_PtrEntry( vShards, Vec_IntEntry(vShardIds, i) );
+                Vec_IntClear( vTemp0 );
+                for ( k = 0; k < nRange0; k++ )
+                    Vec_IntPush( vTemp0, pFans0[k] );
+                for ( k = nRange0; k < Gia_ManCiNum(pShard); k++ )
+                    Vec_IntPush( vTemp0, pFans1[k - nRange0] );
+                fMerged = Gia_ManShardAppend( pNew, pShard, Vec_IntArray(vTemp0), vRes );
+                Vec_PtrWriteEntry( vShards, Vec_IntEntry(vShardIds, i), NULL );
+                Gia_ManStop( pShard );
+                nShardsMerged += fMerged;
+            }
+            if ( !fMerged )
+                Wlc_BlastArith( pNew, p, pObj, pFans0, pFans1, vTemp0, vTemp1, vTemp2, vRes, pPar );
         }
         else if ( pObj->Type == WLC_OBJ_ARI_MINUS )
         {
@@ -1866,36 +2034,6 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
             Wlc_BlastMinus( pNew, pArg0, nRangeMax, vRes );
             Vec_IntShrink( vRes, nRange );
         }
-        else if ( pObj->Type == WLC_OBJ_ARI_POWER )
-        {
-            int nRangeMax = Abc_MaxInt(nRange0, nRange);
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin0(p, pObj) );
-            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRange1, Wlc_ObjIsSignedFanin1(p, pObj) );
-            Wlc_BlastPower( pNew, pArg0, nRangeMax, pArg1, nRange1, vTemp2, vRes );
-            Vec_IntShrink( vRes, nRange );
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_SQRT )
-        {
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0 + (nRange0 & 1), 0 );
-            nRange0 += (nRange0 & 1);
-            if ( pPar->fNonRest )
-                Wlc_BlastSqrtNR( pNew, pArg0, nRange0, vTemp2, vRes );
-            else
-                Wlc_BlastSqrt( pNew, pArg0, nRange0, vTemp2, vRes );
-            if ( nRange > Vec_IntSize(vRes) )
-                Vec_IntFillExtra( vRes, nRange, 0 );
-            else
-                Vec_IntShrink( vRes, nRange );
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_SQUARE )
-        {
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
-            Wlc_BlastSquare( pNew, pArg0, nRange0, vTemp2, vRes );
-            if ( nRange > Vec_IntSize(vRes) )
-                Vec_IntFillExtra( vRes, nRange, 0 );
-            else
-                Vec_IntShrink( vRes, nRange );
-        }
         else if ( pObj->Type == WLC_OBJ_DEC )
         {
             int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
@@ -1927,6 +2065,16 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     }
     p->nAnds[0] = Gia_ManAndNum(pNew);
     assert( nBits == Vec_IntSize(vBits) );
+    if ( vShards )
+    {
+        if ( pPar->fVerbose )
+            printf( "Merged %d out of %d shards (other operators were blasted directly).\n", nShardsMerged, Vec_PtrSize(vShards) );
+        Vec_PtrForEachEntry( Gia_Man_t *, vShards, pTemp, i )
+            if ( pTemp )
+                Gia_ManStop( pTemp );
+        Vec_PtrFree( vShards );
+    }
+    Vec_IntFreeP( &vShardIds );
     Vec_IntFree( vTemp0 );
     Vec_IntFree( vTemp1 );
     Vec_IntFree( vTemp2 );
@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nThreads;         // the number of threads for timing update
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -733,7 +734,10 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
     pArrOut->rise = ArrOut1.rise - ArrOut0.rise;
 }
 
+/*=== sclLibCache.c ===============================================================*/
+extern SC_Lib *      Abc_SclReadLibertyCached( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose );
 /*=== sclLiberty.c ===============================================================*/
+extern Vec_Str_t *   Abc_SclReadLibertyStr( char * pFileName, int fVerbose, int fVeryVerbose );
 extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
@@ -0,0 +1,366 @@
+/**CFile****************************************************************
+
+  FileName    [sclLibCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Content-hashed cache of parsed Liberty libraries.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: sclLibCache.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclLib.h"
+#include "base/main/main.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache entry of a Liberty file is named after the 64-bit hash of
+// the file contents and stores the SCL byte string derived from the file
+// by the Liberty reader, that is, exactly the input of Abc_SclReadFromStr().
+// Loading a library from the cache skips parsing altogether.
+// The cache is used if it is requested by "read_lib -c" or if the cache
+// directory is given by the flag "libcache" (set libcache <dir>); by
+// default, the directory is "$HOME/.cache/abc". If the directory cannot
+// be determined or written, the library is parsed as usual.
+
+#define SCL_CACHE_MAGIC    ABC_CONST(0x31454843414C4353)  // "SCLCACH1"
+#define SCL_CACHE_HEADER   6                               // header size in words
+#define SCL_CACHE_CHUNK    (1 << 20)                       // words read at a time while hashing
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the hash of the file contents and of the data.]
+
+  Description [Returns 0 if the file cannot be read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Abc_SclCacheHashWord( word Hash, word Data )
+{
+    Hash ^= Data;
+    Hash *= ABC_CONST(0x9E3779B97F4A7C15);
+    return Hash ^ (Hash >> 29);
+}
+static word Abc_SclCacheHashFile( char * pFileName, word * pSize )
+{
+    word * pBuffer, Hash = ABC_CONST(0xCBF29CE484222325);
+    size_t i, nBytes, nWords;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    *pSize = 0;
+    pBuffer = ABC_ALLOC( word, SCL_CACHE_CHUNK );
+    while ( (nBytes = fread( pBuffer, 1, sizeof(word) * SCL_CACHE_CHUNK, pFile )) > 0 )
+    {
+        // zero-pad the last incomplete word
+        nWords = (nBytes + sizeof(word) - 1) / sizeof(word);
+        if ( nBytes % sizeof(word) )
+            memset( (char *)pBuffer + nBytes, 0, nWords * sizeof(word) - nBytes );
+        for ( i = 0; i < nWords; i++ )
+            Hash = Abc_SclCacheHashWord( Hash, pBuffer[i] );
+        *pSize += nBytes;
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return Abc_SclCacheHashWord( Hash, *pSize );
+}
+static word Abc_SclCacheHashData( char * pData, word nBytes )
+{
+    word i, Data, Hash = ABC_CONST(0xCBF29CE484222325);
+    for ( i = 0; i + sizeof(word) <= nBytes; i += sizeof(word) )
+        Hash = Abc_SclCacheHashWord( Hash, *(word *)(pData + i) );
+    if ( i < nBytes )
+    {
+        Data = 0;
+        memcpy( &Data, pData + i, (size_t)(nBytes - i) );
+        Hash = Abc_SclCacheHashWord( Hash, Data );
+    }
+    return Abc_SclCacheHashWord( Hash, nBytes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the cache entry.]
+
+  Description [Returns NULL if the cache directory is not given and
+  HOME is not set. The directory is created when the entry is saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclCacheMakeDir( char * pDirName )
+{
+    char * pCur;
+    for ( pCur = pDirName + 1; ; pCur++ )
+    {
+        if ( *pCur != '/' && *pCur != '\\' && *pCur != 0 )
+            continue;
+        if ( pCur[-1] != '/' && pCur[-1] != '\\' && pCur[-1] != ':' )
+        {
+            char Temp = *pCur;
+            *pCur = 0;
+#ifdef _WIN32
+            _mkdir( pDirName );
+#else
+            mkdir( pDirName, 0777 );
+#endif
+            *pCur = Temp;
+        }
+        if ( *pCur == 0 )
+            break;
+    }
+}
+static char * Abc_SclCacheFileName( word Hash )
+{
+    char * pDirName = Abc_FrameReadFlag( "libcache" );
+    char * pHome, * pFileName;
+    Vec_Str_t * vName = Vec_StrAlloc( 100 );
+    if ( pDirName && *pDirName )
+        Vec_StrPrintStr( vName, pDirName );
+    else if ( (pHome = getenv("HOME")) != NULL && *pHome )
+    {
+        Vec_StrPrintStr( vName, pHome );
+        Vec_StrPrintStr( vName, "/.cache/abc" );
+    }
+    else
+    {
+        Vec_StrFree( vName );
+        return NULL;
+    }
+    Vec_StrPrintF( vName, "/%016llx.sclc", (unsigned long long)Hash );
+    Vec_StrPush( vName, '\0' );
+    pFileName = Abc_UtilStrsav( Vec_StrArray(vName) );
+    Vec_StrFree( vName );
+    return pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the library from the cache entry.]
+
+  Description [Returns NULL if the entry does not exist, does not match
+  the Liberty file, or is damaged. The entry is memory-mapped when possible
+  and the SCL string is read in place.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static SC_Lib * Abc_SclCacheLoadFromMemory( char * pContents, word nContents, word Hash, word Size )
+{
+    word * pHeader = (word *)pContents;
+    Vec_Str_t vStr;
+    if ( nContents < sizeof(word) * SCL_CACHE_HEADER )
+        return NULL;
+    if ( pHeader[0] != SCL_CACHE_MAGIC || pHeader[1] != (word)ABC_SCL_CUR_VERSION ||
+         pHeader[2] != Size || pHeader[3] != Hash || pHeader[4] != nContents - sizeof(word) * SCL_CACHE_HEADER )
+        return NULL;
+    if ( pHeader[4] == 0 || pHeader[4] >= (word)ABC_INFINITY )
+        return NULL;
+    vStr.nCap   = (int)pHeader[4];
+    vStr.nSize  = (int)pHeader[4];
+    vStr.pArray = pContents + sizeof(word) * SCL_CACHE_HEADER;
+    if ( pHeader[5] != Abc_SclCacheHashData( vStr.pArray, pHeader[4] ) )
+        return NULL;
+    return Abc_SclReadFromStr( &vStr );
+}
+static SC_Lib * Abc_SclCacheLoad( char * pCacheName, word Hash, word Size )
+{
+    SC_Lib * pLib = NULL;
+    char * pContents;
+    FILE * pFile;
+    long nFileSize;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pCacheName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+    {
+        pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        close( fd );
+        if ( pContents != (char *)MAP_FAILED )
+        {
+            pLib = Abc_SclCacheLoadFromMemory( pContents, (word)Stat.st_size, Hash, Size );
+            munmap( pContents, (size_t)Stat.st_size );
+            return pLib;
+        }
+    }
+    else
+        close( fd );
+#endif
+    pFile = fopen( pCacheName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    rewind( pFile );
+    if ( nFileSize > 0 )
+    {
+        pContents = ABC_ALLOC( char, nFileSize );
+        if ( fread( pContents, nFileSize, 1, pFile ) == 1 )
+            pLib = Abc_SclCacheLoadFromMemory( pContents, (word)nFileSize, Hash, Size );
+        ABC_FREE( pContents );
+    }
+    fclose( pFile );
+    return pLib;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the SCL string into the cache entry.]
+
+  Description [Creates the cache directory if it does not exist. Writes
+  a temporary file first and renames it, so that concurrent runs never
+  observe an incomplete entry.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclCacheSave( char * pCacheName, Vec_Str_t * vStr, word Hash, word Size )
+{
+    word pHeader[SCL_CACHE_HEADER] = { SCL_CACHE_MAGIC, (word)ABC_SCL_CUR_VERSION, Size, Hash, (word)Vec_StrSize(vStr),
+                                   Abc_SclCacheHashData( Vec_StrArray(vStr), (word)Vec_StrSize(vStr) ) };
+    char * pTempName = ABC_ALLOC( char, strlen(pCacheName) + 30 );
+    char * pDirName = Abc_UtilStrsav( pCacheName ), * pSlash = strrchr( pDirName, '/' );
+    int RetValue = 1;
+    FILE * pFile;
+    if ( pSlash && pSlash > pDirName )
+    {
+        *pSlash = 0;
+        Abc_SclCacheMakeDir( pDirName );
+    }
+    ABC_FREE( pDirName );
+#ifdef _WIN32
+    sprintf( pTempName, "%s.tmp", pCacheName );
+#else
+    sprintf( pTempName, "%s.%d.tmp", pCacheName, (int)getpid() );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pTempName );
+        return 0;
+    }
+    RetValue &= fwrite( pHeader, sizeof(word), SCL_CACHE_HEADER, pFile ) == SCL_CACHE_HEADER;
+    RetValue &= fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile ) == (size_t)Vec_StrSize(vStr);
+    RetValue &= fclose( pFile ) == 0;
+#ifdef _WIN32
+    remove( pCacheName );
+#endif
+    if ( !RetValue || rename( pTempName, pCacheName ) != 0 )
+    {
+        remove( pTempName );
+        RetValue = 0;
+    }
+    ABC_FREE( pTempName );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads Liberty library using the cache.]
+
+  Description [If the cache contains the entry for the contents of the
+  Liberty file, the library is loaded from it without parsing. Otherwise,
+  the file is parsed and the entry is created.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadLibertyCached( char * pFileName, int fUseCache, int fVerbose, int fVeryVerbose )
+{
+    abctime clk = Abc_Clock();
+    SC_Lib * pLib = NULL;
+    Vec_Str_t * vStr;
+    char * pCacheName = NULL;
+    word Hash = 0, Size = 0;
+    if ( !fUseCache )
+        return Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
+    Hash = Abc_SclCacheHashFile( pFileName, &Size );
+    if ( Size > 0 )
+        pCacheName = Abc_SclCacheFileName( Hash );
+    if ( pCacheName == NULL )
+        return Abc_SclReadLiberty( pFileName, fVerbose, fVeryVerbose );
+    pLib = Abc_SclCacheLoad( pCacheName, Hash, Size );
+    if ( pLib != NULL )
+    {
+        pLib->pFileName = Abc_UtilStrsav( pFileName );
+        Abc_SclLibNormalize( pLib );
+        if ( fVerbose )
+        {
+            printf( "Library \"%s\" from \"%s\" has %d cells (cached in \"%s\").  ",
+                pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        ABC_FREE( pCacheName );
+        return pLib;
+    }
+    // parse the file and remember the result
+    vStr = Abc_SclReadLibertyStr( pFileName, fVerbose, fVeryVerbose );
+    if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
+        return NULL;
+    }
+    if ( Abc_SclCacheSave( pCacheName, vStr, Hash, Size ) )
+    {
+        if ( fVerbose )
+            printf( "Saved the parsed library into cache file \"%s\".\n", pCacheName );
+    }
+    else if ( fVerbose )
+        printf( "Cannot write cache file \"%s\".\n", pCacheName );
+    ABC_FREE( pCacheName );
+    pLib = Abc_SclReadFromStr( vStr );
+    Vec_StrFree( vStr );
+    if ( pLib == NULL )
+        return NULL;
+    pLib->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( pLib );
+    return pLib;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -1677,9 +1677,8 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+Vec_Str_t * Abc_SclReadLibertyStr( char * pFileName, int fVerbose, int fVeryVerbose )
 {
-    SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
     p = Scl_LibertyParse( pFileName, fVeryVerbose );
@@ -1689,6 +1688,13 @@ SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
     // collect relevant data
     vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
     Scl_LibertyStop( p, fVeryVerbose );
+    return vStr;
+}
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+{
+    SC_Lib * pLib;
+    Vec_Str_t * vStr;
+    vStr = Abc_SclReadLibertyStr( pFileName, fVerbose, fVeryVerbose );
     if ( vStr == NULL )
         return NULL;
     // construct SCL data-structure
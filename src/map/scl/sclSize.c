@@ -399,18 +399,11 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 }
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
-    Abc_Obj_t * pObj;
     float D;
-    int i;
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
-    p->nEstNodes = 0;
-    Abc_NtkForEachCi( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachCo( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    Abc_SclStaBuild( p );
+    Abc_SclStaArrivals( p );
     D = Abc_SclReadMaxDelay( p );
     if ( fReverse && DUser > 0 && D < DUser )
         D = DUser;
@@ -419,11 +412,7 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     if ( pDelay )
         *pDelay = D;
     if ( fReverse )
-    {
-        p->nEstNodes = 0;
-        Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
-            Abc_SclTimeNode( p, pObj, 1 );
-    }
+        Abc_SclStaDepartures( p );
 }
 
 /**Function*************************************************************
@@ -541,6 +530,8 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
 {
     Abc_Obj_t * pObj;
     int i, RetValue;
+    if ( p->vStaTypes )
+        return Abc_SclStaIncUpdate( p );
     if ( Vec_IntSize(p->vChanged) == 0 )
         return 0;
 //    Abc_SclTimeIncCheckLevel( p->pNtk );
@@ -630,9 +621,10 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nThreads = Abc_MaxInt( nThreads, 1 );
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -668,10 +660,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nThreads );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -689,12 +681,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nThreads );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +891,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
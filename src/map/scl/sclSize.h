@@ -82,6 +82,18 @@ struct SC_Man_
     Vec_Wec_t *    vLevels;
     Vec_Int_t *    vChanged; 
     int            nIncUpdates;
+    // flat timing graph
+    int            nThreads;      // the number of threads
+    Vec_Str_t *    vStaTypes;     // object types
+    Vec_Str_t *    vStaMarks;     // object marks used by incremental update
+    Vec_Int_t *    vStaLevel;     // object levels
+    Vec_Int_t *    vStaFanBeg;    // the first fanin of each object
+    Vec_Int_t *    vStaFanins;    // fanins of all objects
+    Vec_Int_t *    vStaFoBeg;     // the first fanout of each object
+    Vec_Int_t *    vStaFanouts;   // fanouts of all objects (object, pin)
+    Vec_Int_t *    vStaOrder;     // CIs and internal nodes in a topological order
+    Vec_Wec_t *    vStaNodes;     // CIs and internal nodes by level
+    Vec_Wec_t *    vStaDirty;     // objects to update by level
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -180,6 +192,7 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->vNodeIter   = Vec_IntStartFull( p->nObjs );
     p->vLevels     = Vec_WecStart( 2 * Abc_NtkLevel(pNtk) + 1 );
     p->vChanged    = Vec_IntAlloc( 100 );
+    p->nThreads    = 1;
     Abc_NtkForEachCo( pNtk, pObj, i )
         pObj->Level = Abc_ObjFanin0(pObj)->Level + 1;
     // set CI/CO ids
@@ -215,6 +228,17 @@ static inline void Abc_SclManFree( SC_Man * p )
     Vec_IntFreeP( &p->vGatesBest );
     Vec_WecFreeP( &p->vLevels );
     Vec_IntFreeP( &p->vChanged );
+    // flat timing graph
+    Vec_StrFreeP( &p->vStaTypes );
+    Vec_StrFreeP( &p->vStaMarks );
+    Vec_IntFreeP( &p->vStaLevel );
+    Vec_IntFreeP( &p->vStaFanBeg );
+    Vec_IntFreeP( &p->vStaFanins );
+    Vec_IntFreeP( &p->vStaFoBeg );
+    Vec_IntFreeP( &p->vStaFanouts );
+    Vec_IntFreeP( &p->vStaOrder );
+    Vec_WecFreeP( &p->vStaNodes );
+    Vec_WecFreeP( &p->vStaDirty );
 //    Vec_QuePrint( p->vQue );
     Vec_QueCheck( p->vQue );
     Vec_QueFreeP( &p->vQue );
@@ -563,14 +587,19 @@ extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Ab
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nThreads );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nThreads );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
+/*=== sclSta.c ===============================================================*/
+extern void          Abc_SclStaBuild( SC_Man * p );
+extern void          Abc_SclStaArrivals( SC_Man * p );
+extern void          Abc_SclStaDepartures( SC_Man * p );
+extern int           Abc_SclStaIncUpdate( SC_Man * p );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
 extern void          Abc_SclUpsizePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPars );
@@ -0,0 +1,527 @@
+/**CFile****************************************************************
+
+  FileName    [sclSta.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Standard-cell library representation.]
+
+  Synopsis    [Levelized timing analysis on the flat timing graph.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: sclSta.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sclSize.h"
+#include "misc/util/utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the timing graph keeps, for each object ID, its type, its level, its
+// fanins, and its fanouts with the pin numbers of the fanout cells;
+// the internal nodes (together with the CIs and the constant nodes on
+// level 0) are grouped by level, and the COs are on the top level;
+// arrival times are computed by pulling from the fanins, and departure
+// times are computed by pulling from the fanouts, so that the nodes of
+// one level can be processed in any order and on any thread
+
+#define SCL_STA_NONE   0    // unused object or latch
+#define SCL_STA_CI     1    // combinational input
+#define SCL_STA_CO     2    // combinational output
+#define SCL_STA_NODE   3    // internal node
+#define SCL_STA_CONST  4    // internal node without fanins
+
+#define SCL_STA_DIRTY  1    // the object is scheduled for update
+#define SCL_STA_CHANGE 2    // the timing of the object has changed
+
+#define SCL_STA_CHUNK  256  // the smallest number of objects in one task
+
+typedef struct Scl_StaPar_t_ Scl_StaPar_t;
+struct Scl_StaPar_t_
+{
+    SC_Man *       pMan;          // timing manager
+    int            Mode;          // the kind of update (see Abc_SclStaRange)
+    int            nChunk;        // the number of objects in one task
+    Vec_Int_t *    vTasks;        // tasks for the levels (level, first object)
+    int *          pObjs;         // objects of the current level
+    int            nObjs;         // the number of objects of the current level
+    int            nEsts[UTIL_PTH_MAX]; // the number of estimations by thread
+};
+
+static inline int       Abc_SclStaType( SC_Man * p, int i )      { return Vec_StrEntry(p->vStaTypes, i);                                 }
+static inline SC_Cell * Abc_SclStaCell( SC_Man * p, int i )      { return SC_LibCell(p->pLib, Vec_IntEntry(p->pNtk->vGates, i));         }
+static inline int       Abc_SclStaFaninNum( SC_Man * p, int i )  { return Vec_IntEntry(p->vStaFanBeg, i+1) - Vec_IntEntry(p->vStaFanBeg, i); }
+static inline int *     Abc_SclStaFanins( SC_Man * p, int i )    { return Vec_IntEntryP(p->vStaFanins, Vec_IntEntry(p->vStaFanBeg, i));  }
+static inline int       Abc_SclStaFanoutNum( SC_Man * p, int i ) { return Vec_IntEntry(p->vStaFoBeg, i+1) - Vec_IntEntry(p->vStaFoBeg, i);   }
+static inline int *     Abc_SclStaFanouts( SC_Man * p, int i )   { return Vec_IntEntryP(p->vStaFanouts, 2*Vec_IntEntry(p->vStaFoBeg, i)); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Compiles the network into the flat timing graph.]
+
+  Description [The graph is rebuilt from scratch by each full timing
+  update because the sizing engines may change the network structure
+  between the updates (for example, when buffers are bypassed). The
+  objects are assumed to be in a topological order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclStaBuild( SC_Man * p )
+{
+    Abc_Ntk_t * pNtk = p->pNtk;
+    Abc_Obj_t * pObj, * pFanin;
+    Vec_Int_t * vNext;
+    int * pBeg, * pFans, * pLevel, * pFoBeg, * pFanouts, * pNext;
+    int i, k, iFanin, Level, nLevels = 0;
+    assert( Abc_NtkObjNumMax(pNtk) == p->nObjs );
+    if ( p->vStaTypes == NULL )
+    {
+        p->vStaTypes   = Vec_StrAlloc( p->nObjs );
+        p->vStaMarks   = Vec_StrAlloc( p->nObjs );
+        p->vStaLevel   = Vec_IntAlloc( p->nObjs );
+        p->vStaFanBeg  = Vec_IntAlloc( p->nObjs + 1 );
+        p->vStaFanins  = Vec_IntAlloc( 3 * p->nObjs );
+        p->vStaFoBeg   = Vec_IntAlloc( p->nObjs + 1 );
+        p->vStaFanouts = Vec_IntAlloc( 6 * p->nObjs );
+        p->vStaOrder   = Vec_IntAlloc( p->nObjs );
+    }
+    Vec_StrFill( p->vStaTypes, p->nObjs, SCL_STA_NONE );
+    Vec_StrFill( p->vStaMarks, p->nObjs, 0 );
+    Vec_IntFill( p->vStaLevel, p->nObjs, 0 );
+    Vec_IntClear( p->vStaFanBeg );
+    Vec_IntClear( p->vStaFanins );
+    // collect the fanins of the nodes and the COs
+    for ( i = 0; i < p->nObjs; i++ )
+    {
+        Vec_IntPush( p->vStaFanBeg, Vec_IntSize(p->vStaFanins) );
+        pObj = Abc_NtkObj( pNtk, i );
+        if ( pObj == NULL )
+            continue;
+        if ( Abc_ObjIsCi(pObj) )
+            Vec_StrWriteEntry( p->vStaTypes, i, SCL_STA_CI );
+        else if ( Abc_ObjIsCo(pObj) )
+            Vec_StrWriteEntry( p->vStaTypes, i, SCL_STA_CO );
+        else if ( Abc_ObjIsNode(pObj) )
+            Vec_StrWriteEntry( p->vStaTypes, i, (char)(Abc_ObjFaninNum(pObj) ? SCL_STA_NODE : SCL_STA_CONST) );
+        else
+            continue;
+        if ( Abc_ObjIsCi(pObj) )
+            continue;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Vec_IntPush( p->vStaFanins, Abc_ObjId(pFanin) );
+    }
+    Vec_IntPush( p->vStaFanBeg, Vec_IntSize(p->vStaFanins) );
+    // compute the levels of the nodes
+    pBeg   = Vec_IntArray( p->vStaFanBeg );
+    pFans  = Vec_IntArray( p->vStaFanins );
+    pLevel = Vec_IntArray( p->vStaLevel );
+    Abc_NtkForEachNode1( pNtk, pObj, i )
+    {
+        Level = 0;
+        for ( k = pBeg[i]; k < pBeg[i+1]; k++ )
+            Level = Abc_MaxInt( Level, pLevel[pFans[k]] );
+        pLevel[i] = ++Level;
+        nLevels = Abc_MaxInt( nLevels, Level );
+    }
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        pLevel[Abc_ObjId(pObj)] = nLevels + 1;
+    // order the nodes by ID (for one thread) and by level (for several threads)
+    Vec_IntClear( p->vStaOrder );
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        Vec_IntPush( p->vStaOrder, Abc_ObjId(pObj) );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        Vec_IntPush( p->vStaOrder, i );
+    Vec_WecFreeP( &p->vStaNodes );
+    Vec_WecFreeP( &p->vStaDirty );
+    p->vStaNodes = Vec_WecStart( nLevels + 1 );
+    p->vStaDirty = Vec_WecStart( nLevels + 2 );
+    if ( p->nThreads > 1 )
+        Vec_IntForEachEntry( p->vStaOrder, iFanin, i )
+            Vec_WecPush( p->vStaNodes, pLevel[iFanin], iFanin );
+    // collect the fanouts with the pin numbers (-1 for the COs)
+    Vec_IntFill( p->vStaFoBeg, p->nObjs + 1, 0 );
+    Vec_IntFill( p->vStaFanouts, 2 * Vec_IntSize(p->vStaFanins), 0 );
+    pFoBeg = Vec_IntArray( p->vStaFoBeg );
+    pFanouts = Vec_IntArray( p->vStaFanouts );
+    for ( k = 0; k < pBeg[p->nObjs]; k++ )
+        pFoBeg[pFans[k] + 1]++;
+    for ( i = 0; i < p->nObjs; i++ )
+        pFoBeg[i + 1] += pFoBeg[i];
+    vNext = Vec_IntDup( p->vStaFoBeg );
+    pNext = Vec_IntArray( vNext );
+    for ( i = 0; i < p->nObjs; i++ )
+        for ( k = pBeg[i]; k < pBeg[i+1]; k++ )
+        {
+            iFanin = pFans[k];
+            pFanouts[2 * pNext[iFanin] + 0] = i;
+            pFanouts[2 * pNext[iFanin] + 1] = Abc_SclStaType(p, i) == SCL_STA_CO ? -1 : k - pBeg[i];
+            pNext[iFanin]++;
+        }
+    Vec_IntFree( vNext );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Timing computation for one object.]
+
+  Description [These procedures write only the timing data of the given
+  object, so they can be called concurrently for the objects of one
+  level. They return 1 if the buffer tree estimation was applied.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline float Abc_SclStaLoadValue( SC_Man * p, int iObj )
+{
+    return (0.5 * p->pLoads[iObj].fall + 0.5 * p->pLoads[iObj].rise) / (p->EstLoadAve * p->EstLoadMax);
+}
+static inline int Abc_SclStaTimeObj( SC_Man * p, int iObj )
+{
+    SC_Cell * pCell;
+    SC_Pair Load = p->pLoads[iObj];
+    float Value = p->EstLoadMax ? Abc_SclStaLoadValue( p, iObj ) : 0;
+    int k, nFanins, * pFanins, fEst = p->EstLoadMax && Value > 1;
+    if ( Abc_SclStaType(p, iObj) == SCL_STA_CI )
+    {
+        if ( p->pPiDrive != NULL )
+            Scl_LibHandleInputDriver( p->pPiDrive, p->pLoads + iObj, p->pTimes + iObj, p->pSlews + iObj );
+        return 0;
+    }
+    assert( Abc_SclStaType(p, iObj) == SCL_STA_NODE || Abc_SclStaType(p, iObj) == SCL_STA_CONST );
+    if ( fEst )
+        Load.rise = Load.fall = p->EstLoadAve * p->EstLoadMax;
+    pCell   = Abc_SclStaCell( p, iObj );
+    pFanins = Abc_SclStaFanins( p, iObj );
+    nFanins = Abc_SclStaFaninNum( p, iObj );
+    for ( k = 0; k < nFanins; k++ )
+        Scl_LibPinArrival( Scl_CellPinTime(pCell, k), p->pTimes + pFanins[k], p->pSlews + pFanins[k], &Load, p->pTimes + iObj, p->pSlews + iObj );
+    if ( fEst )
+    {
+        float EstDelta = p->EstLinear * log( Value );
+        p->pTimes[iObj].rise += EstDelta;
+        p->pTimes[iObj].fall += EstDelta;
+    }
+    return fEst;
+}
+static inline int Abc_SclStaDeptObj( SC_Man * p, int iObj, int fEst )
+{
+    SC_Pair Load, Dept, * pDepIn = p->pDepts + iObj;
+    float Value;
+    int k, iFanout, iPin, * pFanouts = Abc_SclStaFanouts( p, iObj );
+    int nFanouts = Abc_SclStaFanoutNum( p, iObj );
+    SC_PairClean( pDepIn );
+    for ( k = 0; k < nFanouts; k++ )
+    {
+        iFanout = pFanouts[2*k+0];
+        iPin    = pFanouts[2*k+1];
+        if ( iPin == -1 )
+            continue;
+        Load = p->pLoads[iFanout];
+        Dept = p->pDepts[iFanout];
+        if ( fEst && p->EstLoadMax && (Value = Abc_SclStaLoadValue(p, iFanout)) > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise = Load.fall = p->EstLoadAve * p->EstLoadMax;
+            Dept.rise += EstDelta;
+            Dept.fall += EstDelta;
+        }
+        Scl_LibPinDeparture( Scl_CellPinTime(Abc_SclStaCell(p, iFanout), iPin), pDepIn, p->pSlews + iObj, &Load, &Dept );
+    }
+    return fEst && p->EstLoadMax && Abc_SclStaType(p, iObj) == SCL_STA_NODE && Abc_SclStaLoadValue(p, iObj) > 1;
+}
+static inline void Abc_SclStaTimeCo( SC_Man * p, Abc_Obj_t * pObj )
+{
+    Abc_SclObjDupFanin( p, pObj );
+    Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
+    Vec_QueUpdate( p->vQue, pObj->iData );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes a range of objects on one thread.]
+
+  Description [Mode 0 (1) computes the arrival (departure) times for the
+  full update. Mode 2 (3) recomputes the arrival (departure) times for
+  the incremental update and marks the objects whose timing changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclStaRange( Scl_StaPar_t * pPar, int * pObjs, int nObjs, int iThread )
+{
+    SC_Man * p = pPar->pMan;
+    SC_Pair Old1, Old2;
+    float E = (float)0.1;
+    int i, iObj, nEsts = 0;
+    for ( i = 0; i < nObjs; i++ )
+    {
+        iObj = pObjs[i];
+        if ( pPar->Mode == 0 )
+        {
+            if ( Abc_SclStaType(p, iObj) != SCL_STA_CONST )
+                nEsts += Abc_SclStaTimeObj( p, iObj );
+        }
+        else if ( pPar->Mode == 1 )
+            nEsts += Abc_SclStaDeptObj( p, iObj, 1 );
+        else if ( pPar->Mode == 2 )
+        {
+            SC_PairMove( &Old1, p->pTimes + iObj );
+            SC_PairMove( &Old2, p->pSlews + iObj );
+            nEsts += Abc_SclStaTimeObj( p, iObj );
+            if ( !SC_PairEqualE(&Old1, p->pTimes + iObj, E) || !SC_PairEqualE(&Old2, p->pSlews + iObj, E) )
+                Vec_StrWriteEntry( p->vStaMarks, iObj, SCL_STA_DIRTY | SCL_STA_CHANGE );
+        }
+        else if ( pPar->Mode == 3 )
+        {
+            Old1 = p->pDepts[iObj];
+            Abc_SclStaDeptObj( p, iObj, 0 );
+            if ( !SC_PairEqualE(&Old1, p->pDepts + iObj, E) )
+                Vec_StrWriteEntry( p->vStaMarks, iObj, SCL_STA_DIRTY | SCL_STA_CHANGE );
+        }
+        else assert( 0 );
+    }
+    pPar->nEsts[iThread] += nEsts;
+}
+static void Abc_SclStaTaskLevel( void * pArg, int iTask, int iThread )
+{
+    Scl_StaPar_t * pPar = (Scl_StaPar_t *)pArg;
+    Vec_Int_t * vLevel = Vec_WecEntry( pPar->pMan->vStaNodes, Vec_IntEntry(pPar->vTasks, 2*iTask) );
+    int iStart = Vec_IntEntry( pPar->vTasks, 2*iTask+1 );
+    int iStop  = Abc_MinInt( iStart + pPar->nChunk, Vec_IntSize(vLevel) );
+    Abc_SclStaRange( pPar, Vec_IntArray(vLevel) + iStart, iStop - iStart, iThread );
+}
+static void Abc_SclStaTaskRange( void * pArg, int iTask, int iThread )
+{
+    Scl_StaPar_t * pPar = (Scl_StaPar_t *)pArg;
+    int iStart = iTask * pPar->nChunk;
+    int iStop  = Abc_MinInt( iStart + pPar->nChunk, pPar->nObjs );
+    Abc_SclStaRange( pPar, pPar->pObjs + iStart, iStop - iStart, iThread );
+}
+static int Abc_SclStaCountEsts( Scl_StaPar_t * pPar )
+{
+    int i, Count = 0;
+    for ( i = 0; i < UTIL_PTH_MAX; i++ )
+        Count += pPar->nEsts[i];
+    return Count;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Visits all levels of the timing graph.]
+
+  Description [Levels are visited in the direct order for the arrival
+  times and in the reverse order for the departure times. The nodes of
+  each level are split into chunks processed by the threads, and the
+  next level is started when the previous one is finished. With one
+  thread, the nodes are visited in the order of IDs, which has better
+  memory locality than the order of levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclStaRunLevels( SC_Man * p, Scl_StaPar_t * pPar, int fReverse )
+{
+    Vec_Int_t * vLevel, * vStages;
+    int i, k, Count = Vec_WecSize(p->vStaNodes);
+    if ( p->nThreads <= 1 || !Util_PthEnabled() )
+    {
+        int * pOrder = Vec_IntArray( p->vStaOrder );
+        if ( !fReverse )
+            Abc_SclStaRange( pPar, pOrder, Vec_IntSize(p->vStaOrder), 0 );
+        else for ( i = Vec_IntSize(p->vStaOrder) - 1; i >= 0; i-- )
+            Abc_SclStaRange( pPar, pOrder + i, 1, 0 );
+        return;
+    }
+    pPar->nChunk = Abc_MaxInt( SCL_STA_CHUNK, Vec_WecSizeSize(p->vStaNodes) / Abc_MaxInt(1, Count) / (4 * p->nThreads) );
+    pPar->vTasks = Vec_IntAlloc( 1000 );
+    vStages = Vec_IntAlloc( Count + 1 );
+    for ( i = 0; i < Count; i++ )
+    {
+        vLevel = Vec_WecEntry( p->vStaNodes, fReverse ? Count - 1 - i : i );
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        Vec_IntPush( vStages, Vec_IntSize(pPar->vTasks) / 2 );
+        for ( k = 0; k < Vec_IntSize(vLevel); k += pPar->nChunk )
+            Vec_IntPushTwo( pPar->vTasks, fReverse ? Count - 1 - i : i, k );
+    }
+    Vec_IntPush( vStages, Vec_IntSize(pPar->vTasks) / 2 );
+    Util_PthRunStages( p->nThreads, Vec_IntSize(vStages) - 1, Vec_IntArray(vStages), Abc_SclStaTaskLevel, NULL, pPar );
+    Vec_IntFree( vStages );
+    Vec_IntFreeP( &pPar->vTasks );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival and departure times of all objects.]
+
+  Description [Assumes that the loads are computed, the timing data is
+  cleaned, and the timing graph is built.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclStaArrivals( SC_Man * p )
+{
+    Scl_StaPar_t Par, * pPar = &Par;
+    Abc_Obj_t * pObj;
+    int i;
+    memset( pPar, 0, sizeof(Scl_StaPar_t) );
+    pPar->pMan = p;
+    pPar->Mode = 0;
+    Abc_SclStaRunLevels( p, pPar, 0 );
+    Abc_NtkForEachCo( p->pNtk, pObj, i )
+        Abc_SclStaTimeCo( p, pObj );
+    p->nEstNodes = Abc_SclStaCountEsts( pPar );
+}
+void Abc_SclStaDepartures( SC_Man * p )
+{
+    Scl_StaPar_t Par, * pPar = &Par;
+    memset( pPar, 0, sizeof(Scl_StaPar_t) );
+    pPar->pMan = p;
+    pPar->Mode = 1;
+    Abc_SclStaRunLevels( p, pPar, 1 );
+    p->nEstNodes = Abc_SclStaCountEsts( pPar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Incremental timing update.]
+
+  Description [Starting from the objects whose cells have changed,
+  updates the arrival times of their transitive fanout and then the
+  departure times of the transitive fanin of the changed objects. The
+  propagation stops at the objects whose timing did not change. Returns
+  the number of objects updated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclStaIncAddObj( SC_Man * p, int iObj )
+{
+    assert( Abc_SclStaType(p, iObj) != SCL_STA_NONE );
+    assert( Vec_StrEntry(p->vStaMarks, iObj) == 0 );
+    Vec_StrWriteEntry( p->vStaMarks, iObj, SCL_STA_DIRTY );
+    Vec_WecPush( p->vStaDirty, Vec_IntEntry(p->vStaLevel, iObj), iObj );
+    p->nIncUpdates++;
+}
+static inline void Abc_SclStaIncAddFanins( SC_Man * p, int iObj )
+{
+    int k, * pFanins = Abc_SclStaFanins( p, iObj );
+    for ( k = 0; k < Abc_SclStaFaninNum(p, iObj); k++ )
+        if ( Vec_StrEntry(p->vStaMarks, pFanins[k]) == 0 )
+            Abc_SclStaIncAddObj( p, pFanins[k] );
+}
+static inline void Abc_SclStaIncAddFanouts( SC_Man * p, int iObj )
+{
+    int k, * pFanouts = Abc_SclStaFanouts( p, iObj );
+    for ( k = 0; k < Abc_SclStaFanoutNum(p, iObj); k++ )
+        if ( Vec_StrEntry(p->vStaMarks, pFanouts[2*k]) == 0 )
+            Abc_SclStaIncAddObj( p, pFanouts[2*k] );
+}
+static void Abc_SclStaIncRunLevel( SC_Man * p, Scl_StaPar_t * pPar, Vec_Int_t * vLevel, int fDept )
+{
+    int k, iObj;
+    pPar->Mode   = fDept ? 3 : 2;
+    pPar->pObjs  = Vec_IntArray( vLevel );
+    pPar->nObjs  = Vec_IntSize( vLevel );
+    pPar->nChunk = Abc_MaxInt( SCL_STA_CHUNK, pPar->nObjs / (4 * p->nThreads) );
+    if ( p->nThreads > 1 && pPar->nObjs >= 2 * SCL_STA_CHUNK )
+        Util_PthRun( p->nThreads, (pPar->nObjs + pPar->nChunk - 1) / pPar->nChunk, Abc_SclStaTaskRange, pPar );
+    else
+        Abc_SclStaRange( pPar, pPar->pObjs, pPar->nObjs, 0 );
+    // the newly scheduled objects are on other levels, so the level does not grow
+    Vec_IntForEachEntry( vLevel, iObj, k )
+    {
+        if ( !(Vec_StrEntry(p->vStaMarks, iObj) & SCL_STA_CHANGE) )
+            continue;
+        Vec_StrWriteEntry( p->vStaMarks, iObj, SCL_STA_DIRTY );
+        if ( fDept )
+            Abc_SclStaIncAddFanins( p, iObj );
+        else
+            Abc_SclStaIncAddFanouts( p, iObj );
+    }
+}
+int Abc_SclStaIncUpdate( SC_Man * p )
+{
+    Scl_StaPar_t Par, * pPar = &Par;
+    Vec_Int_t * vLevel;
+    Abc_Obj_t * pObj;
+    int i, k, iObj, RetValue;
+    if ( Vec_IntSize(p->vChanged) == 0 )
+        return 0;
+    memset( pPar, 0, sizeof(Scl_StaPar_t) );
+    pPar->pMan = p;
+    Vec_IntForEachEntry( p->vChanged, iObj, i )
+    {
+        Abc_SclStaIncAddFanins( p, iObj );
+        if ( Vec_StrEntry(p->vStaMarks, iObj) )
+            continue;
+        Abc_SclStaIncAddObj( p, iObj );
+    }
+    Vec_IntClear( p->vChanged );
+    // update arrival times; the COs are on the last level
+    Vec_WecForEachLevel( p->vStaDirty, vLevel, i )
+    {
+        if ( i < Vec_WecSize(p->vStaDirty) - 1 )
+        {
+            Abc_SclStaIncRunLevel( p, pPar, vLevel, 0 );
+            continue;
+        }
+        Abc_NtkForEachObjVec( vLevel, p->pNtk, pObj, k )
+            Abc_SclStaTimeCo( p, pObj );
+    }
+    p->MaxDelay = Abc_SclReadMaxDelay( p );
+    // update departure times
+    Vec_WecForEachLevelReverse( p->vStaDirty, vLevel, i )
+        Abc_SclStaIncRunLevel( p, pPar, vLevel, 1 );
+    p->MaxDelay = Abc_SclReadMaxDelay( p );
+    p->nEstNodes += Abc_SclStaCountEsts( pPar );
+    // clean the marks
+    Vec_WecForEachLevel( p->vStaDirty, vLevel, i )
+    {
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            assert( Vec_StrEntry(p->vStaMarks, iObj) == SCL_STA_DIRTY );
+            Vec_StrWriteEntry( p->vStaMarks, iObj, 0 );
+        }
+        Vec_IntClear( vLevel );
+    }
+    RetValue = p->nIncUpdates;
+    p->nIncUpdates = 0;
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
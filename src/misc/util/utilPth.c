@@ -0,0 +1,332 @@
+/**CFile****************************************************************
+
+  FileName    [utilPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Thread utilities.]
+
+  Synopsis    [Running independent tasks on several threads.]
+
+  Author      [agent]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilPth.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#include "abc_global.h"
+#include "utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Util_PthData_t_ Util_PthData_t;
+struct Util_PthData_t_
+{
+    Util_PthTask_t   pTask;       // the task procedure
+    Util_PthStage_t  pStage;      // the stage procedure (or NULL)
+    void *           pUser;       // the user data
+    int              nTasks;      // the number of tasks
+    int              iNext;       // the next task to be started
+    int              nStages;     // the number of stages
+    int *            pStages;     // the first task of each stage
+    int              iStage;      // the current stage
+    int              nDone;       // the number of completed tasks
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // protects iNext, iStage and nDone
+    pthread_cond_t   Cond;        // signals the start of the next stage
+#endif
+};
+
+typedef struct Util_PthThread_t_ Util_PthThread_t;
+struct Util_PthThread_t_
+{
+    Util_PthData_t * pData;       // shared data
+    int              iThread;     // thread number
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the tasks can run on several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PthEnabled()
+{
+#ifdef ABC_USE_PTHREADS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs tasks 0, 1, ..., nTasks-1 using nThreads threads.]
+
+  Description [The tasks are handed out in the increasing order to the 
+  threads that become available. The procedure returns when all tasks 
+  are completed. The tasks should not depend on each other; if each task 
+  writes only its own part of the result, the result does not depend on 
+  the number of threads. The thread number passed to the task procedure 
+  is in the range 0..nThreads-1 and can be used to select per-thread 
+  scratch data. Without pthreads or with one thread, tasks run in order 
+  on the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void * Util_PthWorker( void * pArg )
+{
+    Util_PthThread_t * pThread = (Util_PthThread_t *)pArg;
+    Util_PthData_t * p = pThread->pData;
+    int iTask;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        iTask = p->iNext < p->nTasks ? p->iNext++ : -1;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( iTask == -1 )
+            break;
+        p->pTask( p->pUser, iTask, pThread->iThread );
+    }
+    return NULL;
+}
+#endif
+void Util_PthRun( int nThreads, int nTasks, Util_PthTask_t pTask, void * pUser )
+{
+#ifdef ABC_USE_PTHREADS
+    Util_PthData_t Data, * p = &Data;
+    Util_PthThread_t Threads[UTIL_PTH_MAX];
+    pthread_t WorkerThread[UTIL_PTH_MAX];
+    int i, status;
+    nThreads = Abc_MinInt( Abc_MinInt(nThreads, nTasks), UTIL_PTH_MAX );
+    if ( nThreads > 1 )
+    {
+        p->pTask  = pTask;
+        p->pUser  = pUser;
+        p->nTasks = nTasks;
+        p->iNext  = 0;
+        status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Threads[i].pData   = p;
+            Threads[i].iThread = i;
+            if ( i == 0 )
+                continue;
+            status = pthread_create( WorkerThread + i, NULL, Util_PthWorker, (void *)(Threads + i) );  assert( status == 0 );
+        }
+        // the calling thread works as thread 0
+        Util_PthWorker( (void *)Threads );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        pthread_mutex_destroy( &p->Mutex );
+        return;
+    }
+#endif
+    {
+        int iTask;
+        for ( iTask = 0; iTask < nTasks; iTask++ )
+            pTask( pUser, iTask, 0 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs tasks in stages using nThreads threads.]
+
+  Description [Stage s consists of tasks pStages[s], ..., pStages[s+1]-1, 
+  so the array has nStages+1 entries and the last one is the total number 
+  of tasks. The tasks of one stage run concurrently, while a stage starts 
+  only after all tasks of the previous stages are completed, so a task may 
+  use the results of the earlier stages. The threads are created once for 
+  all stages. This is intended for the levelized traversals, in which 
+  there are many stages and starting the threads for each of them would 
+  cost more than the work itself. If the stage procedure is given, it is 
+  called after each stage is completed and before the next one starts, 
+  while no task is running, so it can move data between the threads. 
+  Without pthreads or with one thread, tasks run in order on the calling 
+  thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void * Util_PthStageWorker( void * pArg )
+{
+    Util_PthThread_t * pThread = (Util_PthThread_t *)pArg;
+    Util_PthData_t * p = pThread->pData;
+    int iTask;
+    pthread_mutex_lock( &p->Mutex );
+    while ( p->iNext < p->nTasks )
+    {
+        if ( p->iNext == p->pStages[p->iStage+1] )
+        {
+            // the current stage is handed out but not completed
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+            continue;
+        }
+        iTask = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        p->pTask( p->pUser, iTask, pThread->iThread );
+        pthread_mutex_lock( &p->Mutex );
+        if ( ++p->nDone < p->pStages[p->iStage+1] )
+            continue;
+        // the current stage is completed; skip the empty ones
+        while ( p->iStage < p->nStages && p->pStages[p->iStage+1] == p->nDone )
+        {
+            if ( p->pStage )
+                p->pStage( p->pUser, p->iStage );
+            p->iStage++;
+        }
+        pthread_cond_broadcast( &p->Cond );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+    return NULL;
+}
+#endif
+void Util_PthRunStages( int nThreads, int nStages, int * pStages, Util_PthTask_t pTask, Util_PthStage_t pStage, void * pUser )
+{
+    int nTasks = pStages[nStages];
+    assert( pStages[0] == 0 );
+#ifdef ABC_USE_PTHREADS
+    nThreads = Abc_MinInt( Abc_MinInt(nThreads, nTasks), UTIL_PTH_MAX );
+    if ( nThreads > 1 )
+    {
+        Util_PthData_t Data, * p = &Data;
+        Util_PthThread_t Threads[UTIL_PTH_MAX];
+        pthread_t WorkerThread[UTIL_PTH_MAX];
+        int i, status;
+        p->pTask   = pTask;
+        p->pStage  = pStage;
+        p->pUser   = pUser;
+        p->nTasks  = nTasks;
+        p->iNext   = 0;
+        p->nStages = nStages;
+        p->pStages = pStages;
+        p->iStage  = 0;
+        p->nDone   = 0;
+        while ( p->iStage < nStages && pStages[p->iStage+1] == 0 )
+            p->iStage++;
+        status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+        status = pthread_cond_init( &p->Cond, NULL );    assert( status == 0 );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Threads[i].pData   = p;
+            Threads[i].iThread = i;
+            if ( i == 0 )
+                continue;
+            status = pthread_create( WorkerThread + i, NULL, Util_PthStageWorker, (void *)(Threads + i) );  assert( status == 0 );
+        }
+        // the calling thread works as thread 0
+        Util_PthStageWorker( (void *)Threads );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        pthread_cond_destroy( &p->Cond );
+        pthread_mutex_destroy( &p->Mutex );
+        return;
+    }
+#endif
+    {
+        int iStage, iTask;
+        for ( iStage = 0; iStage < nStages; iStage++ )
+        {
+            for ( iTask = pStages[iStage]; iTask < pStages[iStage+1]; iTask++ )
+                pTask( pUser, iTask, 0 );
+            if ( pStage )
+                pStage( pUser, iStage );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Atomically adds a number to an integer.]
+
+  Description [Returns the new value. Can be used by concurrent tasks to 
+  take entries from a shared counter or to release shared references.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PthAtomicAdd( int * pValue, int Add )
+{
+#if defined(ABC_USE_PTHREADS) && (defined(__GNUC__) || defined(__clang__))
+    return __sync_add_and_fetch( pValue, Add );
+#elif defined(ABC_USE_PTHREADS) && defined(_MSC_VER)
+    return _InterlockedExchangeAdd( (long volatile *)pValue, Add ) + Add;
+#else
+    return *pValue += Add;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Issues a full memory barrier.]
+
+  Description [The writes before the barrier become visible to other 
+  threads before the writes after it, and the reads after the barrier 
+  are not done before the reads before it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PthMemoryBarrier()
+{
+#if defined(ABC_USE_PTHREADS) && (defined(__GNUC__) || defined(__clang__))
+    __sync_synchronize();
+#elif defined(ABC_USE_PTHREADS) && defined(_MSC_VER)
+    _mm_mfence();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
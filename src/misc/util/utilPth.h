@@ -0,0 +1,67 @@
+/**CFile****************************************************************
+
+  FileName    [utilPth.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Thread utilities.]
+
+  Synopsis    [Running independent tasks on several threads.]
+
+  Author      [agent]
+  
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilPth.h,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+ 
+#ifndef ABC__misc__util__utilPth_h
+#define ABC__misc__util__utilPth_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+#define UTIL_PTH_MAX 256
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the task procedure: user data, the task number, the thread number
+typedef void (*Util_PthTask_t)( void * pUser, int iTask, int iThread );
+// the stage procedure: user data, the completed stage
+typedef void (*Util_PthStage_t)( void * pUser, int iStage );
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilPth.c ==========================================================*/
+
+extern int       Util_PthEnabled();
+extern void      Util_PthRun( int nThreads, int nTasks, Util_PthTask_t pTask, void * pUser );
+extern void      Util_PthRunStages( int nThreads, int nStages, int * pStages, Util_PthTask_t pTask, Util_PthStage_t pStage, void * pUser );
+extern int       Util_PthAtomicAdd( int * pValue, int Add );
+extern void      Util_PthMemoryBarrier();
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
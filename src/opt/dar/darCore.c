@@ -59,6 +59,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nThreads     =  1;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
@@ -67,16 +68,18 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Rewrites the AIG in place.]
 
-  Description []
+  Description [If pLib is not NULL, it is a private copy of the library
+  prepared by Dar_LibStartPrivate(); otherwise, the global library is
+  used, which should be prepared by the caller.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+int Dar_ManRewriteLib( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, void * pLib )
 {
     extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
     Dar_Man_t * p;
@@ -87,10 +90,9 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     abctime clk = 0, clkStart;
     int Counter = 0;
     int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
-    // prepare the library
-    Dar_LibPrepare( pPars->nSubgMax ); 
     // create rewriting manager
     p = Dar_ManStart( pAig, pPars );
+    p->pLib = pLib;
     if ( pPars->fPower )
         pAig->vProbs = Saig_ManComputeSwitchProbs( pAig, 48, 16, 1 );
     // remove dangling nodes
@@ -246,6 +248,12 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
     }
     return 1;
 }
+int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    // prepare the library
+    Dar_LibPrepare( pPars->nSubgMax ); 
+    return Dar_ManRewriteLib( pAig, pPars, NULL );
+}
 
 /**Function*************************************************************
 
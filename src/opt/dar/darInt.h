@@ -69,6 +69,7 @@ struct Dar_Man_t_
     // input data
     Dar_RwrPar_t *   pPars;          // rewriting parameters
     Aig_Man_t *      pAig;           // AIG manager 
+    void *           pLib;           // private subgraph library (or NULL)
     // various data members
     Aig_MmFixed_t *  pMemCuts;       // memory manager for cuts
     void *           pManCnf;        // CNF managers
@@ -130,6 +131,7 @@ static inline void         Dar_ObjSetCuts( Aig_Obj_t * pObj, Dar_Cut_t * pCuts )
 
 /*=== darBalance.c ========================================================*/
 /*=== darCore.c ===========================================================*/
+extern int             Dar_ManRewriteLib( Aig_Man_t * pAig, Dar_RwrPar_t * pPars, void * pLib );
 /*=== darCut.c ============================================================*/
 extern void            Dar_ManCutsRestart( Dar_Man_t * p, Aig_Obj_t * pRoot );
 extern void            Dar_ManCutsFree( Dar_Man_t * p );
@@ -144,6 +146,8 @@ extern Vec_Int_t *     Dar_LibReadPrios();
 /*=== darLib.c ============================================================*/
 extern void            Dar_LibStart();
 extern void            Dar_LibStop();
+extern void *          Dar_LibStartPrivate( int nSubgraphs );
+extern void            Dar_LibStopPrivate( void * pLib );
 extern void            Dar_LibReturnCanonicals( unsigned * pCanons );
 extern void            Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize );
 extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
@@ -0,0 +1,292 @@
+/**CFile****************************************************************
+
+  FileName    [darPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Multi-threaded rewriting of independent windows.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: darPar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "darInt.h"
+#include "misc/util/utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DAR_PAR_WIN_MIN  2000   // the smallest number of nodes in one window
+#define DAR_PAR_WIN_TASK    4   // the number of windows per thread
+
+typedef struct Dar_ParMan_t_ Dar_ParMan_t;
+struct Dar_ParMan_t_
+{
+    Dar_RwrPar_t     Pars;      // rewriting parameters of one window
+    Vec_Ptr_t *      vWins;     // the window AIGs
+    void **          pLibs;     // the private libraries, one per thread
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the nodes into windows.]
+
+  Description [The nodes are listed in the DFS order and cut into chunks
+  of consecutive nodes. Each node belongs to exactly one window, and the
+  fanins of a node belong to the same window or to the previous ones.
+  Returns the window of each node (-1 for other objects).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Dar_ManParWindows( Aig_Man_t * p, int nWinSize, Vec_Int_t ** pvWinIds )
+{
+    Vec_Wec_t * vWins = Vec_WecAlloc( Aig_ManNodeNum(p) / nWinSize + 1 );
+    Vec_Int_t * vWinIds = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    Vec_Ptr_t * vNodes = Aig_ManDfs( p, 1 );
+    Vec_Int_t * vWin = NULL;
+    Aig_Obj_t * pObj; int i;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        if ( vWin == NULL || Vec_IntSize(vWin) == nWinSize )
+            vWin = Vec_WecPushLevel( vWins );
+        Vec_IntPush( vWin, Aig_ObjId(pObj) );
+        Vec_IntWriteEntry( vWinIds, Aig_ObjId(pObj), Vec_WecSize(vWins)-1 );
+    }
+    Vec_PtrFree( vNodes );
+    *pvWinIds = vWinIds;
+    return vWins;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG of one window.]
+
+  Description [The inputs are the fanins outside of the window, and the
+  outputs are the nodes used outside of the window, both in the order of
+  the nodes. The inputs keep the levels of the original nodes, so that
+  the level-aware rewriting sees the global picture.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Dar_ManParAddInput( Aig_Man_t * pWin, Aig_Obj_t * pFanin, Vec_Int_t * vIns, Vec_Int_t * vWinIds, int iWin )
+{
+    Aig_Obj_t * pObjNew;
+    if ( Aig_ObjIsConst1(pFanin) || Vec_IntEntry(vWinIds, Aig_ObjId(pFanin)) == iWin || pFanin->pData )
+        return;
+    pObjNew = Aig_ObjCreateCi( pWin );
+    pObjNew->Level = pFanin->Level;
+    pFanin->pData = pObjNew;
+    Vec_IntPush( vIns, Aig_ObjId(pFanin) );
+}
+Aig_Man_t * Dar_ManParWindow( Aig_Man_t * p, Vec_Int_t * vWin, Vec_Int_t * vWinIds, int iWin, Vec_Bit_t * vUsed, Vec_Int_t * vIns, Vec_Int_t * vOuts )
+{
+    Aig_Man_t * pWin;
+    Aig_Obj_t * pObj; int i;
+    pWin = Aig_ManStart( Vec_IntSize(vWin) );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pWin);
+    Aig_ManForEachObjVec( vWin, p, pObj, i )
+    {
+        Dar_ManParAddInput( pWin, Aig_ObjFanin0(pObj), vIns, vWinIds, iWin );
+        Dar_ManParAddInput( pWin, Aig_ObjFanin1(pObj), vIns, vWinIds, iWin );
+        pObj->pData = Aig_And( pWin, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    }
+    Aig_ManForEachObjVec( vWin, p, pObj, i )
+        if ( Vec_BitEntry(vUsed, Aig_ObjId(pObj)) )
+        {
+            Aig_ObjCreateCo( pWin, (Aig_Obj_t *)pObj->pData );
+            Vec_IntPush( vOuts, Aig_ObjId(pObj) );
+        }
+    // clean the copies for the next window
+    Aig_ManForEachObjVec( vIns, p, pObj, i )
+        pObj->pData = NULL;
+    Aig_ManForEachObjVec( vWin, p, pObj, i )
+        pObj->pData = NULL;
+    return pWin;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites one window.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManParTask( void * pUser, int iTask, int iThread )
+{
+    Dar_ParMan_t * p = (Dar_ParMan_t *)pUser;
+    Aig_Man_t * pWin = (Aig_Man_t *)Vec_PtrEntry( p->vWins, iTask );
+    Aig_Man_t * pNew;
+    Dar_ManRewriteLib( pWin, &p->Pars, p->pLibs[iThread] );
+    pNew = Aig_ManDupDfs( pWin );
+    Aig_ManStop( pWin );
+    Vec_PtrWriteEntry( p->vWins, iTask, pNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting on one thread.]
+
+  Description [Returns a new AIG; the original one is not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Dar_ManRewriteSerial( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Aig_Man_t * pNew, * pTemp;
+    pNew = Aig_ManDupDfs( pAig );
+    Dar_ManRewrite( pNew, pPars );
+    pNew = Aig_ManDupDfs( pTemp = pNew );
+    Aig_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting of independent windows on several threads.]
+
+  Description [Partitions the nodes into windows with disjoint sets of
+  nodes, rewrites each window using a private copy of the library, and
+  stitches the results together with structural hashing. Rewriting does
+  not cross the window boundaries, so the MFFCs considered are limited
+  to one window. The windows do not depend on the scheduling of threads,
+  so the result is the same for a fixed number of threads. If the stitched
+  AIG fails the check, the serial rewriting is performed instead. Returns
+  a new AIG; the original one is not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Dar_ParMan_t Par, * p = &Par;
+    Aig_Man_t * pNew, * pWin;
+    Aig_Obj_t * pObj, * pObjWin;
+    Vec_Wec_t * vWins, * vIns, * vOuts;
+    Vec_Int_t * vWinIds, * vWin;
+    Vec_Bit_t * vUsed;
+    int i, k, nThreads, nWinSize, nNodesBeg = Aig_ManNodeNum(pAig);
+    abctime clk = Abc_Clock();
+    nThreads = Abc_MinInt( pPars->nThreads, UTIL_PTH_MAX );
+    if ( nThreads <= 1 || !Util_PthEnabled() || pAig->pEquivs || pAig->pManTime || Aig_ManBufNum(pAig) || Aig_ManNodeNum(pAig) < 2 * DAR_PAR_WIN_MIN )
+        return Dar_ManRewriteSerial( pAig, pPars );
+    // partition the nodes
+    nWinSize = Abc_MaxInt( DAR_PAR_WIN_MIN, Abc_MaxInt(1, nNodesBeg / (DAR_PAR_WIN_TASK * nThreads)) );
+    vWins = Dar_ManParWindows( pAig, nWinSize, &vWinIds );
+    // mark the nodes used outside of their windows
+    vUsed = Vec_BitStart( Aig_ManObjNumMax(pAig) );
+    Aig_ManForEachNode( pAig, pObj, i )
+    {
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) && Vec_IntEntry(vWinIds, Aig_ObjFaninId0(pObj)) != Vec_IntEntry(vWinIds, i) )
+            Vec_BitWriteEntry( vUsed, Aig_ObjFaninId0(pObj), 1 );
+        if ( Aig_ObjIsNode(Aig_ObjFanin1(pObj)) && Vec_IntEntry(vWinIds, Aig_ObjFaninId1(pObj)) != Vec_IntEntry(vWinIds, i) )
+            Vec_BitWriteEntry( vUsed, Aig_ObjFaninId1(pObj), 1 );
+    }
+    Aig_ManForEachCo( pAig, pObj, i )
+        if ( Aig_ObjIsNode(Aig_ObjFanin0(pObj)) )
+            Vec_BitWriteEntry( vUsed, Aig_ObjFaninId0(pObj), 1 );
+    // derive the windows
+    memset( p, 0, sizeof(Dar_ParMan_t) );
+    p->Pars = *pPars;
+    p->Pars.fVerbose = 0;
+    p->Pars.fVeryVerbose = 0;
+    p->vWins = Vec_PtrAlloc( Vec_WecSize(vWins) );
+    vIns  = Vec_WecStart( Vec_WecSize(vWins) );
+    vOuts = Vec_WecStart( Vec_WecSize(vWins) );
+    Aig_ManCleanData( pAig );
+    Vec_WecForEachLevel( vWins, vWin, i )
+        Vec_PtrPush( p->vWins, Dar_ManParWindow(pAig, vWin, vWinIds, i, vUsed, Vec_WecEntry(vIns, i), Vec_WecEntry(vOuts, i)) );
+    // rewrite the windows
+    nThreads = Abc_MinInt( nThreads, Vec_WecSize(vWins) );
+    p->pLibs = ABC_ALLOC( void *, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+        p->pLibs[i] = Dar_LibStartPrivate( pPars->nSubgMax );
+    Util_PthRun( nThreads, Vec_PtrSize(p->vWins), Dar_ManParTask, p );
+    for ( i = 0; i < nThreads; i++ )
+        Dar_LibStopPrivate( p->pLibs[i] );
+    ABC_FREE( p->pLibs );
+    // stitch the windows
+    pNew = Aig_ManStart( Aig_ManObjNumMax(pAig) );
+    pNew->pName = Abc_UtilStrsav( pAig->pName );
+    pNew->pSpec = Abc_UtilStrsav( pAig->pSpec );
+    pNew->nAsserts = pAig->nAsserts;
+    pNew->nConstrs = pAig->nConstrs;
+    if ( pAig->vFlopNums )
+        pNew->vFlopNums = Vec_IntDup( pAig->vFlopNums );
+    Aig_ManCleanData( pAig );
+    Aig_ManConst1(pAig)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachCi( pAig, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Aig_Man_t *, p->vWins, pWin, i )
+    {
+        Aig_ManCleanData( pWin );
+        Aig_ManConst1(pWin)->pData = Aig_ManConst1(pNew);
+        Aig_ManForEachObjVec( Vec_WecEntry(vIns, i), pAig, pObj, k )
+            Aig_ManCi(pWin, k)->pData = pObj->pData;
+        Aig_ManForEachNode( pWin, pObjWin, k )
+            pObjWin->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObjWin), Aig_ObjChild1Copy(pObjWin) );
+        Aig_ManForEachObjVec( Vec_WecEntry(vOuts, i), pAig, pObj, k )
+            pObj->pData = Aig_ObjChild0Copy( Aig_ManCo(pWin, k) );
+    }
+    Aig_ManForEachCo( pAig, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManCleanup( pNew );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(pAig) );
+    if ( pPars->fVerbose )
+    {
+        printf( "Rewriting %d windows (up to %d nodes) on %d threads: Nodes %d -> %d.  ",
+            Vec_PtrSize(p->vWins), nWinSize, nThreads, nNodesBeg, Aig_ManNodeNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFreeFunc( p->vWins, (void (*)(void *))Aig_ManStop );
+    Vec_WecFree( vWins );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    Vec_IntFree( vWinIds );
+    Vec_BitFree( vUsed );
+    if ( !Aig_ManCheck(pNew) )
+    {
+        printf( "Dar_ManRewritePar(): The check has failed. Performing serial rewriting.\n" );
+        Aig_ManStop( pNew );
+        return Dar_ManRewriteSerial( pAig, pPars );
+    }
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
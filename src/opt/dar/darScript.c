@@ -221,6 +221,32 @@ Aig_Man_t * Dar_ManCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
     return pAig;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs one rewriting step and returns the cleaned-up AIG.]
+
+  Description [Rewrites the windows of the AIG on several threads if 
+  requested. Frees the original AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Dar_ManRewriteStep( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Aig_Man_t * pTemp;
+    if ( pPars->nThreads > 1 )
+        pAig = Dar_ManRewritePar( pTemp = pAig, pPars );
+    else
+    {
+        Dar_ManRewrite( pAig, pPars );
+        pAig = Aig_ManDupDfs( pTemp = pAig ); 
+    }
+    Aig_ManStop( pTemp );
+    return pAig;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reproduces script "compress2".]
@@ -232,7 +258,7 @@ Aig_Man_t * Dar_ManCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Aig_Man_t * Dar_ManCompress2Par( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nThreads, int fVerbose )
 //alias compress2   "b -l; rw -l; rf -l; b -l; rw -l; rwz -l; b -l; rfz -l; rwz -l; b -l"
 {
     Aig_Man_t * pTemp;
@@ -247,6 +273,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     pParsRef->fUpdateLevel = fUpdateLevel;
     pParsRwr->fFanout = fFanout;
     pParsRwr->fPower = fPower;
+    pParsRwr->nThreads = nThreads;
 
     pParsRwr->fVerbose = 0;//fVerbose;
     pParsRef->fVerbose = 0;//fVerbose;
@@ -265,11 +292,9 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     // rewrite
 //    Dar_ManRewrite( pAig, pParsRwr );
     pParsRwr->fUpdateLevel = 0;  // disable level update
-    Dar_ManRewrite( pAig, pParsRwr );
+    pAig = Dar_ManRewriteStep( pAig, pParsRwr );
     pParsRwr->fUpdateLevel = fUpdateLevel;  // reenable level update if needed
 
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
-    Aig_ManStop( pTemp );
     if ( fVerbose ) printf( "Rewrite:   " ), Aig_ManPrintStats( pAig );
     
     // refactor
@@ -287,18 +312,14 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     }
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
-    Aig_ManStop( pTemp );
+    pAig = Dar_ManRewriteStep( pAig, pParsRwr );
     if ( fVerbose ) printf( "Rewrite:   " ), Aig_ManPrintStats( pAig );
 
     pParsRwr->fUseZeros = 1;
     pParsRef->fUseZeros = 1;
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
-    Aig_ManStop( pTemp );
+    pAig = Dar_ManRewriteStep( pAig, pParsRwr );
     if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
 
     // balance
@@ -316,9 +337,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     if ( fVerbose ) printf( "RefactorZ: " ), Aig_ManPrintStats( pAig );
     
     // rewrite
-    Dar_ManRewrite( pAig, pParsRwr );
-    pAig = Aig_ManDupDfs( pTemp = pAig ); 
-    Aig_ManStop( pTemp );
+    pAig = Dar_ManRewriteStep( pAig, pParsRwr );
     if ( fVerbose ) printf( "RewriteZ:  " ), Aig_ManPrintStats( pAig );
 
     // balance
@@ -330,6 +349,10 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     }
     return pAig;
 }
+Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+{
+    return Dar_ManCompress2Par( pAig, fBalance, fUpdateLevel, fFanout, fPower, 1, fVerbose );
+}
 
 /**Function*************************************************************
 
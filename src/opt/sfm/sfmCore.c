@@ -20,6 +20,7 @@
 
 #include "sfmInt.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilPth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -52,6 +53,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nThreads     =    1;  // the number of threads
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -214,6 +216,16 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // when processing speculatively, only record the change
+    if ( p->pSpec )
+    {
+        p->pSpec->Type      = 1;
+        p->pSpec->iFanin    = f;
+        p->pSpec->iFaninNew = iVar == -1 ? -1 : Vec_IntEntry(p->vDivs, iVar);
+        p->pSpec->uTruth    = uTruth;
+        memcpy( p->pSpec->pTruth, p->pTruth, sizeof(word) * SFM_WORDS_MAX );
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth, p->pTruth );
     // the number of fanins cannot increase
@@ -280,9 +292,15 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // when processing speculatively, only record the change
+    if ( p->pSpec )
+    {
+        p->pSpec->Type   = 2;
+        p->pSpec->uTruth = uTruth;
+        return 1;
+    }
     // update truth table
-    Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
-    Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+    Sfm_NtkUpdateFunc( p, iNode, uTruth );
     return 1;
 }
 int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
@@ -382,27 +400,32 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    Sfm_NtkForEachNode( p, i )
+    if ( pPars->nThreads > 1 && !pPars->fVeryVerbose && Util_PthEnabled() )
+        Counter = Sfm_NtkPerformPar( p, &CounterLarge );
+    else
     {
-        if ( Sfm_ObjIsFixed( p, i ) )
-            continue;
-        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
-            continue;
-        //if ( Sfm_ObjFaninNum(p, i) < 2 )
-        //    continue;
-        if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
-        {
-            CounterLarge++;
-            continue;
-        }
-        for ( k = 0; Sfm_NodeResub(p, i); k++ )
+        Sfm_NtkForEachNode( p, i )
         {
-//            Counter++;
-//            break;
+            if ( Sfm_ObjIsFixed( p, i ) )
+                continue;
+            if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
+                continue;
+            //if ( Sfm_ObjFaninNum(p, i) < 2 )
+            //    continue;
+            if ( Sfm_ObjFaninNum(p, i) > SFM_SUPP_MAX )
+            {
+                CounterLarge++;
+                continue;
+            }
+            for ( k = 0; Sfm_NodeResub(p, i); k++ )
+            {
+//                Counter++;
+//                break;
+            }
+            Counter += (k > 0);
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+                break;
         }
-        Counter += (k > 0);
-        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
-            break;
     }
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
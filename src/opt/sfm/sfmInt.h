@@ -67,6 +67,16 @@ typedef struct Sfm_Fun_t_ Sfm_Fun_t;
 typedef struct Sfm_Lib_t_ Sfm_Lib_t; 
 typedef struct Sfm_Tim_t_ Sfm_Tim_t;
 typedef struct Sfm_Mit_t_ Sfm_Mit_t;
+typedef struct Sfm_Spec_t_ Sfm_Spec_t;
+
+struct Sfm_Spec_t_
+{
+    int               Type;        // -1 = not computed; 0 = no change; 1 = fanin change; 2 = function change
+    int               iFanin;      // the fanin to be replaced
+    int               iFaninNew;   // the new fanin (-1 if the fanin is removed)
+    word              uTruth;      // the new function
+    word              pTruth[SFM_WORDS_MAX]; // the new function
+};
 
 struct Sfm_Ntk_t_
 {
@@ -114,6 +124,11 @@ struct Sfm_Ntk_t_
     int               nRemoves;    // number of fanin removals
     int               nImproves;   // number of node improvements
     int               nResubs;     // number of resubstitutions
+    // parallel processing
+    Vec_Int_t *       vStamps;     // the last batch in which the object has changed
+    int               iStamp;      // the current batch
+    Vec_Int_t *       vFootprint;  // objects visited while computing the window
+    Sfm_Spec_t *      pSpec;       // the change found while processing the node speculatively
     // counter-examples
     int               nCexes;      // number of CEXes
     Vec_Wrd_t *       vDivCexes;   // counter-examples
@@ -209,6 +224,7 @@ extern int          Sfm_TruthToCnf( word Truth, word * pTruth, int nVars, Vec_In
 extern Vec_Wec_t *  Sfm_CreateCnf( Sfm_Ntk_t * p );
 extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_Int_t * vFaninMap, int iPivotVar );
 /*=== sfmCore.c ==========================================================*/
+extern int          Sfm_NodeResub( Sfm_Ntk_t * p, int iNode );
 /*=== sfmLib.c ==========================================================*/
 extern int          Sfm_LibFindComplInputGate( Vec_Wrd_t * vFuncs, int iGate, int nFanins, int iFanin, int * piFaninNew );
 extern Sfm_Lib_t *  Sfm_LibPrepare( int nVars, int fTwo, int fDelay, int fVerbose, int fLibVerbose );
@@ -222,7 +238,11 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 /*=== sfmNtk.c ==========================================================*/
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
+extern void         Sfm_NtkStampObj( Sfm_Ntk_t * p, int iObj );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth, word * pTruth );
+extern void         Sfm_NtkUpdateFunc( Sfm_Ntk_t * p, int iNode, word uTruth );
+/*=== sfmPar.c ==========================================================*/
+extern int          Sfm_NtkPerformPar( Sfm_Ntk_t * p, int * pCounterLarge );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
@@ -253,6 +253,28 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Records that the object has changed in the current batch.]
+
+  Description [The fanins are marked too because the window of a node
+  reads the levels and fanin counts of the fanouts of its objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkStampObj( Sfm_Ntk_t * p, int iObj )
+{
+    int i, iFanin;
+    if ( p->vStamps == NULL )
+        return;
+    Vec_IntWriteEntry( p->vStamps, iObj, p->iStamp );
+    Sfm_ObjForEachFanin( p, iObj, iFanin, i )
+        Vec_IntWriteEntry( p->vStamps, iFanin, p->iStamp );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs resubstitution for the node.]
@@ -291,6 +313,7 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
     if ( Sfm_ObjFanoutNum(p, iNode) > 0 || Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) )
         return;
     assert( Sfm_ObjIsNode(p, iNode) );
+    Sfm_NtkStampObj( p, iNode );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
     {
         int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
@@ -306,6 +329,7 @@ void Sfm_NtkUpdateLevel_rec( Sfm_Ntk_t * p, int iNode )
     if ( LevelNew == Sfm_ObjLevel(p, iNode) )
         return;
     Sfm_ObjSetLevel( p, iNode, LevelNew );
+    Sfm_NtkStampObj( p, iNode );
     Sfm_ObjForEachFanout( p, iNode, iFanout, i )
         Sfm_NtkUpdateLevel_rec( p, iFanout );
 }
@@ -316,6 +340,8 @@ void Sfm_NtkUpdateLevelR_rec( Sfm_Ntk_t * p, int iNode )
     if ( LevelNew == Sfm_ObjLevelR(p, iNode) )
         return;
     Sfm_ObjSetLevelR( p, iNode, LevelNew );
+    if ( p->vStamps ) // only the pivot node reads its reverse level
+        Vec_IntWriteEntry( p->vStamps, iNode, p->iStamp );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
         Sfm_NtkUpdateLevelR_rec( p, iFanin );
 }
@@ -326,6 +352,9 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
     assert( Sfm_ObjFaninNum(p, iNode) <= SFM_FANIN_MAX );
+    Sfm_NtkStampObj( p, iNode );
+    if ( iFaninNew >= 0 )
+        Sfm_NtkStampObj( p, iFaninNew );
     if ( Abc_TtIsConst0(pTruth, nWords) || Abc_TtIsConst1(pTruth, nWords) )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
@@ -355,6 +384,14 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth,
         Abc_TtCopy( Vec_WrdEntryP(p->vTruths2, Vec_IntEntry(p->vStarts, iNode)), pTruth, nWords, 0 );
     Sfm_TruthToCnf( uTruth, pTruth, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
 }
+void Sfm_NtkUpdateFunc( Sfm_Ntk_t * p, int iNode, word uTruth )
+{
+    assert( Sfm_ObjIsNode(p, iNode) );
+    assert( Sfm_ObjFaninNum(p, iNode) <= 6 );
+    Sfm_NtkStampObj( p, iNode );
+    Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
+    Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+}
 
 /**Function*************************************************************
 
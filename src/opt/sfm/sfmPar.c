@@ -0,0 +1,318 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Multi-threaded resubstitution.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+#include "misc/util/utilPth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The nodes are visited in the same order as in Sfm_NtkPerform(), in batches
+// of consecutive nodes. The nodes of a batch are first processed speculatively
+// by the threads, each using its own window, SAT solver, and traversal IDs,
+// while the network is not modified. The objects visited while computing the
+// window of a node are recorded as its footprint. Next, the changes are committed
+// in the original order. When a change is committed, the changed objects and
+// their neighbors are stamped with the batch number. If the footprint of a node
+// contains a stamped object, the speculative result may be stale, and the node
+// is processed again in the updated network. As a result, the final network
+// does not depend on the number of threads and is the same as without threads.
+// The statistics of a speculative attempt are counted only if its result is used,
+// so that they are also the same as without threads.
+
+#define SFM_PAR_BATCH  16   // the number of nodes per thread in one batch
+#define SFM_PAR_STATS   8   // the number of statistics counted for one attempt
+
+typedef struct Sfm_ParMan_t_ Sfm_ParMan_t;
+struct Sfm_ParMan_t_
+{
+    Sfm_Ntk_t *      pNtk;        // the network
+    Sfm_Ntk_t **     pThreads;    // the private contexts, one per thread
+    Vec_Int_t *      vBatch;      // the nodes of the current batch
+    Vec_Wec_t *      vFootprints; // the objects visited for each node of the batch
+    Sfm_Spec_t *     pSpecs;      // the changes found for each node of the batch
+    int *            pStats;      // the statistics of each node of the batch
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the private context of one thread.]
+
+  Description [The context shares the network with the manager but has
+  its own parameters, traversal IDs, SAT variable maps, window, and SAT
+  solver.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_NtkStartThread( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_CALLOC( Sfm_Ntk_t, 1 );
+    int i;
+    // shared network
+    pNew->nPis     = p->nPis;
+    pNew->nPos     = p->nPos;
+    pNew->nNodes   = p->nNodes;
+    pNew->nObjs    = p->nObjs;
+    pNew->vFixed   = p->vFixed;
+    pNew->vEmpty   = p->vEmpty;
+    pNew->vTruths  = p->vTruths;
+    pNew->vFanins  = p->vFanins;
+    pNew->vStarts  = p->vStarts;
+    pNew->vTruths2 = p->vTruths2;
+    pNew->vFanouts = p->vFanouts;
+    pNew->vLevels  = p->vLevels;
+    pNew->vLevelsR = p->vLevelsR;
+    pNew->vCnfs    = p->vCnfs;
+    // private data
+    pNew->pPars    = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pNew->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->vCover   = Vec_IntAlloc( 1 << 16 );
+    for ( i = 0; i < SFM_FANIN_MAX; i++ )
+        pNew->pTtElems[i] = pNew->TtElems[i];
+    Abc_TtElemInit( pNew->pTtElems, SFM_FANIN_MAX );
+    Sfm_NtkPrepare( pNew );
+    pNew->nLevelMax = p->nLevelMax;
+    return pNew;
+}
+static void Sfm_NtkStopThread( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->pPars );
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFree( p->vCover );
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vDivs  );
+    Vec_IntFreeP( &p->vRoots );
+    Vec_IntFreeP( &p->vTfo   );
+    Vec_WrdFreeP( &p->vDivCexes );
+    Vec_IntFreeP( &p->vOrder );
+    Vec_IntFreeP( &p->vDivVars );
+    Vec_IntFreeP( &p->vDivIds );
+    Vec_IntFreeP( &p->vLits  );
+    Vec_IntFreeP( &p->vValues );
+    Vec_WecFreeP( &p->vClauses );
+    Vec_IntFreeP( &p->vFaninMap );
+    if ( p->pSat  ) sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+static inline int * Sfm_NtkStatsArray( Sfm_Ntk_t * p, int i )
+{
+    int * pStats[SFM_PAR_STATS] = { &p->nTryRemoves, &p->nTryImproves, &p->nTryResubs, &p->nNodesTried, 
+                                    &p->nTotalDivs,  &p->nSatCalls,    &p->nTimeOuts,  &p->nMaxDivs };
+    return pStats[i];
+}
+static void Sfm_NtkAddStats( Sfm_Ntk_t * p, int * pStats )
+{
+    // the numbers of successful changes are counted when committing
+    int i;
+    for ( i = 0; i < SFM_PAR_STATS; i++ )
+        *Sfm_NtkStatsArray(p, i) += pStats[i];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes one node of the batch speculatively.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_NtkParTask( void * pUser, int iTask, int iThread )
+{
+    Sfm_ParMan_t * p = (Sfm_ParMan_t *)pUser;
+    Sfm_Ntk_t * pThr = p->pThreads[iThread];
+    Sfm_Spec_t * pSpec = p->pSpecs + iTask;
+    int * pStats = p->pStats + SFM_PAR_STATS * iTask;
+    int i, iNode = Vec_IntEntry( p->vBatch, iTask );
+    pSpec->Type = -1;
+    if ( Sfm_ObjIsFixed(pThr, iNode) || Sfm_ObjFaninNum(pThr, iNode) > SFM_SUPP_MAX )
+        return;
+    if ( pThr->pPars->nDepthMax && Sfm_ObjLevel(pThr, iNode) > pThr->pPars->nDepthMax )
+        return;
+    pSpec->Type = 0;
+    pThr->pSpec = pSpec;
+    pThr->vFootprint = Vec_WecEntry( p->vFootprints, iTask );
+    Vec_IntClear( pThr->vFootprint );
+    for ( i = 0; i < SFM_PAR_STATS; i++ )
+        pStats[i] = *Sfm_NtkStatsArray(pThr, i);
+    Sfm_NodeResub( pThr, iNode );
+    for ( i = 0; i < SFM_PAR_STATS; i++ )
+        pStats[i] = *Sfm_NtkStatsArray(pThr, i) - pStats[i];
+    pThr->vFootprint = NULL;
+    pThr->pSpec = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Commits the change found speculatively.]
+
+  Description [Returns 0 if the objects visited while computing the
+  change were modified by the changes committed earlier in this batch.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_NtkParFootprintIsValid( Sfm_Ntk_t * p, Vec_Int_t * vFootprint )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( vFootprint, iObj, i )
+        if ( Vec_IntEntry(p->vStamps, iObj) == p->iStamp )
+            return 0;
+    return 1;
+}
+static void Sfm_NtkParCommit( Sfm_Ntk_t * p, int iNode, Sfm_Spec_t * pSpec )
+{
+    if ( pSpec->Type == 1 )
+    {
+        if ( pSpec->iFaninNew == -1 )
+            p->nRemoves++;
+        else
+            p->nResubs++;
+        Sfm_NtkUpdate( p, iNode, pSpec->iFanin, pSpec->iFaninNew, pSpec->uTruth, pSpec->pTruth );
+    }
+    else if ( pSpec->Type == 2 )
+    {
+        p->nImproves++;
+        Sfm_NtkUpdateFunc( p, iNode, pSpec->uTruth );
+    }
+    else assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using several threads.]
+
+  Description [Returns the number of modified nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * pNtk, int * pCounterLarge )
+{
+    Sfm_ParMan_t Par, * p = &Par;
+    Sfm_Par_t * pPars = pNtk->pPars;
+    Sfm_Spec_t * pSpec;
+    int nThreads = Abc_MinInt( pPars->nThreads, UTIL_PTH_MAX );
+    int nBatch = SFM_PAR_BATCH * nThreads;
+    int i, k, iNode, iStart, Counter = 0, fStop = 0;
+    assert( nThreads > 1 && !pPars->fVeryVerbose );
+    memset( p, 0, sizeof(Sfm_ParMan_t) );
+    p->pNtk        = pNtk;
+    p->pThreads    = ABC_ALLOC( Sfm_Ntk_t *, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+        p->pThreads[i] = Sfm_NtkStartThread( pNtk );
+    p->vBatch      = Vec_IntAlloc( nBatch );
+    p->vFootprints = Vec_WecStart( nBatch );
+    p->pSpecs      = ABC_CALLOC( Sfm_Spec_t, nBatch );
+    p->pStats      = ABC_CALLOC( int, SFM_PAR_STATS * nBatch );
+    pNtk->vStamps  = Vec_IntStart( pNtk->nObjs );
+    pNtk->iStamp   = 0;
+    for ( iStart = pNtk->nPis; !fStop && iStart + pNtk->nPos < pNtk->nObjs; iStart += nBatch )
+    {
+        // process the nodes of the batch speculatively
+        Vec_IntClear( p->vBatch );
+        for ( i = iStart; i < iStart + nBatch && i + pNtk->nPos < pNtk->nObjs; i++ )
+            Vec_IntPush( p->vBatch, i );
+        Util_PthRun( nThreads, Vec_IntSize(p->vBatch), Sfm_NtkParTask, p );
+        // commit the changes in the original order
+        pNtk->iStamp++;
+        Vec_IntForEachEntry( p->vBatch, iNode, i )
+        {
+            if ( Sfm_ObjIsFixed( pNtk, iNode ) )
+                continue;
+            if ( pPars->nDepthMax && Sfm_ObjLevel(pNtk, iNode) > pPars->nDepthMax )
+                continue;
+            if ( Sfm_ObjFaninNum(pNtk, iNode) > SFM_SUPP_MAX )
+            {
+                (*pCounterLarge)++;
+                continue;
+            }
+            pSpec = p->pSpecs + i;
+            k = 0;
+            if ( pSpec->Type == -1 || !Sfm_NtkParFootprintIsValid(pNtk, Vec_WecEntry(p->vFootprints, i)) )
+            {
+                for ( k = 0; Sfm_NodeResub(pNtk, iNode); k++ )
+                {
+                }
+            }
+            else 
+            {
+                // the speculative attempt is used in place of the first one
+                Sfm_NtkAddStats( pNtk, p->pStats + SFM_PAR_STATS * i );
+                if ( pSpec->Type > 0 )
+                {
+                    Sfm_NtkParCommit( pNtk, iNode, pSpec );
+                    for ( k = 1; Sfm_NodeResub(pNtk, iNode); k++ )
+                    {
+                    }
+                }
+            }
+            Counter += (k > 0);
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+    }
+    Vec_IntFreeP( &pNtk->vStamps );
+    for ( i = 0; i < nThreads; i++ )
+        Sfm_NtkStopThread( p->pThreads[i] );
+    ABC_FREE( p->pThreads );
+    Vec_IntFree( p->vBatch );
+    Vec_WecFree( p->vFootprints );
+    ABC_FREE( p->pSpecs );
+    ABC_FREE( p->pStats );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -108,6 +108,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nThreads;      // the number of simulation threads
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -132,6 +133,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nThreads;      // the number of simulation threads
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
@@ -166,6 +168,8 @@ struct Cec_ParCor_t_
     // callback
     void *           pData;
     void *           pFunc;
+    int              RunId;         // id in this run
+    int(*pFuncStop)(int);           // callback to terminate
 };
 
 // sequential register correspodence parameters
@@ -227,6 +231,9 @@ extern void          Cec_ManChcSetDefaultParams( Cec_ParChc_t * p );
 extern Gia_Man_t *   Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSilent );
 extern Gia_Man_t *   Cec_ManSatSolving( Gia_Man_t * pAig, Cec_ParSat_t * pPars, int f0Proved );
 extern void          Cec_ManSimulation( Gia_Man_t * pAig, Cec_ParSim_t * pPars );
+/*=== cecProve.c ==========================================================*/
+extern int           Cec_ProveCallBackToStop( int RunId );
+extern int           Cec_GiaProvePortfolio( Gia_Man_t * p, int nProcs, int nTimeOut, int fVerbose );
 /*=== cecSeq.c ==========================================================*/
 extern int           Cec_ManSeqResimulateCounter( Gia_Man_t * pAig, Cec_ParSim_t * pPars, Abc_Cex_t * pCex );
 extern int           Cec_ManSeqSemiformal( Gia_Man_t * pAig, Cec_ParSmf_t * pPars );
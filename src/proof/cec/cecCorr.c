@@ -995,6 +995,14 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
             Abc_Print( 1, "Stopped signal correspondence after %d refiment iterations.\n", r );
             return 1;
         }
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+        {
+            // the classes are not proved yet
+            Cec_ManSimStop( pSim );
+            ABC_FREE( pAig->pReprs );
+            ABC_FREE( pAig->pNexts );
+            return 0;
+        }
         clk = Abc_Clock();
         // perform speculative reduction
         clk2 = Abc_Clock();
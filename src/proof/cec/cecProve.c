@@ -0,0 +1,295 @@
+/**CFile****************************************************************
+
+  FileName    [cecProve.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Portfolio of sequential verification engines.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: cecProve.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+#include "aig/gia/giaAig.h"
+#include "aig/saig/saig.h"
+#include "misc/util/utilPth.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "sat/bmc/bmc.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the engines in the order in which they are given to the threads
+enum { CEC_PRV_PDR, CEC_PRV_BMC3, CEC_PRV_INT, CEC_PRV_BMCS, CEC_PRV_SCORR, CEC_PRV_NUM };
+
+static char * s_PrvNames[CEC_PRV_NUM] = { "pdr", "bmc3", "int", "&bmcs", "&scorr" };
+
+typedef struct Cec_PrvEng_t_ Cec_PrvEng_t;
+struct Cec_PrvEng_t_
+{
+    Aig_Man_t *      pAig;          // the copy of the AIG (pdr, bmc3, int)
+    Gia_Man_t *      pGia;          // the copy of the AIG (&bmcs, &scorr)
+    Abc_Cex_t *      pCex;          // the counter-example
+    int              Status;        // 1 = proved; 0 = failed; -1 = undecided; -2 = not applicable
+    abctime          Time;          // the runtime
+};
+
+typedef struct Cec_Prv_t_ Cec_Prv_t;
+struct Cec_Prv_t_
+{
+    int              nTimeOut;      // the timeout in seconds
+    int              fVerbose;      // verbose stats
+    int              nSolved;       // the number of engines that solved the problem
+    int              iWinner;       // the first engine that solved the problem
+    Cec_PrvEng_t     Engs[CEC_PRV_NUM];
+};
+
+// the state polled by the engines; only one portfolio runs at a time
+static volatile int  s_PrvStop = 0; // set when the problem is solved
+static abctime       s_PrvTimeStop; // the time to stop (0 if no timeout)
+
+extern int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Callback polled by the engines to terminate.]
+
+  Description [Returns 1 when one of the engines has solved the problem
+  or when the timeout is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ProveCallBackToStop( int RunId )
+{
+    return s_PrvStop || (s_PrvTimeStop && Abc_Clock() > s_PrvTimeStop);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine.]
+
+  Description [Each engine works on its own copy of the AIG. The status
+  of the failed property is accepted only if the counter-example
+  verifies on this copy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ProveRunEngine( Cec_Prv_t * p, int iEngine )
+{
+    Cec_PrvEng_t * pEng = p->Engs + iEngine;
+    abctime clk = Abc_Clock();
+    if ( pEng->Status == -2 || Cec_ProveCallBackToStop(iEngine) )
+        return;
+    if ( iEngine == CEC_PRV_PDR )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->nTimeOut  = p->nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = Cec_ProveCallBackToStop;
+        pEng->Status = Pdr_ManSolve( pEng->pAig, pPars );
+    }
+    else if ( iEngine == CEC_PRV_BMC3 )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->nTimeOut  = p->nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = Cec_ProveCallBackToStop;
+        pEng->Status = Saig_ManBmcScalable( pEng->pAig, pPars );
+    }
+    else if ( iEngine == CEC_PRV_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        int iFrame;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->nSecLimit = p->nTimeOut;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = Cec_ProveCallBackToStop;
+        pEng->Status = Inter_ManPerformInterpolation( pEng->pAig, pPars, &iFrame );
+    }
+    else if ( iEngine == CEC_PRV_BMCS )
+    {
+        Bmc_AndPar_t Pars, * pPars = &Pars;
+        memset( pPars, 0, sizeof(Bmc_AndPar_t) );
+        pPars->nFramesAdd  = 1;
+        pPars->nProcs      = 1;
+        pPars->nTimeOut    = p->nTimeOut;
+        pPars->fNotVerbose = 1;
+        pPars->RunId       = iEngine;
+        pPars->pFuncStop   = Cec_ProveCallBackToStop;
+        pEng->Status = Bmcs_ManPerform( pEng->pGia, pPars );
+        pEng->pCex = pEng->pGia->pCexSeq; pEng->pGia->pCexSeq = NULL;
+    }
+    else if ( iEngine == CEC_PRV_SCORR )
+    {
+        Cec_ParCor_t Pars, * pPars = &Pars;
+        Gia_Man_t * pNew;
+        Gia_Obj_t * pObj;
+        int i;
+        Cec_ManCorSetDefaultParams( pPars );
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = Cec_ProveCallBackToStop;
+        pNew = Cec_ManLSCorrespondence( pEng->pGia, pPars );
+        // the property holds if all outputs are reduced to constant 0
+        pEng->Status = 1;
+        Gia_ManForEachPo( pNew, pObj, i )
+            if ( Gia_ObjFaninLit0p(pNew, pObj) != 0 )
+                pEng->Status = -1;
+        Gia_ManStop( pNew );
+    }
+    else assert( 0 );
+    if ( pEng->pAig )
+    {
+        pEng->pCex = pEng->pAig->pSeqModel;
+        pEng->pAig->pSeqModel = NULL;
+    }
+    // check the counter-example
+    if ( pEng->Status == 0 )
+    {
+        int fValid = pEng->pCex != NULL && (pEng->pAig ? Saig_ManVerifyCex(pEng->pAig, pEng->pCex) : Gia_ManVerifyCex(pEng->pGia, pEng->pCex, 0));
+        if ( !fValid )
+        {
+            Abc_Print( 1, "Engine \"%s\" reported a failure without a valid counter-example.\n", s_PrvNames[iEngine] );
+            pEng->Status = -1;
+        }
+    }
+    else if ( pEng->Status != 1 )
+        pEng->Status = -1;
+    pEng->Time = Abc_Clock() - clk;
+    // the first engine that solved the problem stops the others
+    if ( pEng->Status >= 0 && Util_PthAtomicAdd(&p->nSolved, 1) == 1 )
+    {
+        p->iWinner = iEngine;
+        s_PrvStop = 1;
+    }
+}
+static void Cec_ProveTask( void * pUser, int iTask, int iThread )
+{
+    Cec_ProveRunEngine( (Cec_Prv_t *)pUser, iTask );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the portfolio of sequential engines.]
+
+  Description [Runs pdr, bmc3, int, &bmcs and &scorr on their own copies
+  of the AIG using nProcs threads. If there are fewer threads than
+  engines, the remaining engines start when the earlier ones give up.
+  All engines poll the same callback, which tells them to stop when the
+  first of them solves the problem or when the timeout is reached.
+  Returns 1 if the property holds, 0 if it fails (in which case the
+  counter-example is stored in p->pCexSeq), and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaProvePortfolio( Gia_Man_t * p, int nProcs, int nTimeOut, int fVerbose )
+{
+    Cec_Prv_t Prv, * pPrv = &Prv;
+    Cec_PrvEng_t * pEng;
+    abctime clkTotal = Abc_Clock();
+    int i, RetValue = -1;
+    assert( Gia_ManRegNum(p) > 0 );
+    memset( pPrv, 0, sizeof(Cec_Prv_t) );
+    pPrv->nTimeOut = nTimeOut;
+    pPrv->fVerbose = fVerbose;
+    pPrv->iWinner  = -1;
+    // create the copies in advance because the conversion marks the AIG
+    for ( i = 0; i < CEC_PRV_NUM; i++ )
+    {
+        pEng = pPrv->Engs + i;
+        pEng->Status = -1;
+        if ( i == CEC_PRV_INT && (Gia_ManPoNum(p) != 1 || Gia_ManPiNum(p) == 0 || Gia_ManConstrNum(p)) )
+            pEng->Status = -2;
+        else if ( i == CEC_PRV_BMCS || i == CEC_PRV_SCORR )
+            pEng->pGia = Gia_ManDup( p );
+        else
+            pEng->pAig = Gia_ManToAigSimple( p );
+    }
+    if ( fVerbose )
+        Abc_Print( 1, "Running %d engines using %d threads with timeout %d sec.\n", CEC_PRV_NUM, nProcs, nTimeOut );
+    s_PrvStop     = 0;
+    s_PrvTimeStop = nTimeOut ? Abc_Clock() + (abctime)nTimeOut * CLOCKS_PER_SEC : 0;
+    Util_PthRun( nProcs, CEC_PRV_NUM, Cec_ProveTask, pPrv );
+    s_PrvStop     = 0;
+    s_PrvTimeStop = 0;
+    // collect the results
+    if ( pPrv->iWinner >= 0 )
+    {
+        pEng = pPrv->Engs + pPrv->iWinner;
+        RetValue = pEng->Status;
+        if ( RetValue == 0 )
+        {
+            Abc_CexFreeP( &p->pCexSeq );
+            p->pCexSeq = pEng->pCex;
+            pEng->pCex = NULL;
+        }
+    }
+    for ( i = 0; i < CEC_PRV_NUM; i++ )
+    {
+        pEng = pPrv->Engs + i;
+        if ( fVerbose )
+        {
+            Abc_Print( 1, "%-8s: ", s_PrvNames[i] );
+            if ( pEng->Status == -2 )
+                Abc_Print( 1, "not applicable\n" );
+            else
+            {
+                Abc_Print( 1, "%-10s", pEng->Status == 1 ? "proved" : pEng->Status == 0 ? "failed" : "undecided" );
+                Abc_Print( 1, "%s", i == pPrv->iWinner ? " (winner)  " : "           " );
+                Abc_PrintTime( 1, "Time", pEng->Time );
+            }
+        }
+        if ( pEng->Status >= 0 && RetValue >= 0 && pEng->Status != RetValue )
+            Abc_Print( 1, "Error: Engine \"%s\" disagrees with engine \"%s\".\n", s_PrvNames[i], s_PrvNames[pPrv->iWinner] );
+        Abc_CexFreeP( &pEng->pCex );
+        if ( pEng->pAig )
+            Aig_ManStop( pEng->pAig );
+        Gia_ManStopP( &pEng->pGia );
+    }
+    if ( RetValue == 1 )
+        Abc_Print( 1, "Property proved by engine \"%s\".  ", s_PrvNames[pPrv->iWinner] );
+    else if ( RetValue == 0 )
+        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d by engine \"%s\".  ",
+            p->pCexSeq->iPo, p->pName ? p->pName : "", p->pCexSeq->iFrame, s_PrvNames[pPrv->iWinner] );
+    else
+        Abc_Print( 1, "Property undecided.  " );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
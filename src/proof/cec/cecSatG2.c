@@ -110,6 +110,9 @@ struct Cec4_Man_t_
     Vec_Int_t *      vRefBins;
     int *            pTable;
     int              nTableSize;
+    // random numbers (the state is kept in the manager, so that several managers can run concurrently)
+    unsigned         RandZ;
+    unsigned         RandW;
     // statistics
     int              nItersSim;
     int              nItersSat;
@@ -218,6 +221,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nThreads       =       1;    // the number of simulation threads
 }
 
 /**Function*************************************************************
@@ -231,6 +235,23 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
+static inline void Cec4_ManRandomReset( Cec4_Man_t * p )
+{
+    p->RandZ = 3716960521u;
+    p->RandW = 2174103536u;
+}
+static inline unsigned Cec4_ManRandom( Cec4_Man_t * p )
+{
+    p->RandZ = 36969 * (p->RandZ & 65535) + (p->RandZ >> 16);
+    p->RandW = 18000 * (p->RandW & 65535) + (p->RandW >> 16);
+    return (p->RandZ << 16) + p->RandW;
+}
+static inline word Cec4_ManRandomW( Cec4_Man_t * p )
+{
+    word Hi = Cec4_ManRandom( p );
+    word Lo = Cec4_ManRandom( p );
+    return (Hi << 32) | Lo;
+}
 Cec4_Man_t * Cec4_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
 {
     Cec4_Man_t * p = ABC_CALLOC( Cec4_Man_t, 1 );
@@ -870,12 +891,12 @@ static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
         for ( w = 0; w < p->nSimWords; w++ )
             pSim[w] =  pSim0[w] ^ pSim1[w];
 }
-static inline void Cec4_ObjSimCi( Gia_Man_t * p, int iObj )
+static inline void Cec4_ObjSimCi( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
 {
     int w;
     word * pSim = Cec4_ObjSim( p, iObj );
     for ( w = 0; w < p->nSimWords; w++ )
-        pSim[w] = Abc_RandomW( 0 );
+        pSim[w] = Cec4_ManRandomW( pMan );
     pSim[0] <<= 1;
 }
 static inline void Cec4_ObjClearSimCi( Gia_Man_t * p, int iObj )
@@ -885,11 +906,11 @@ static inline void Cec4_ObjClearSimCi( Gia_Man_t * p, int iObj )
     for ( w = 0; w < p->nSimWords; w++ )
         pSim[w] = 0;
 }
-void Cec4_ManSimulateCis( Gia_Man_t * p )
+void Cec4_ManSimulateCis( Gia_Man_t * p, Cec4_Man_t * pMan )
 {
     int i, Id;
     Gia_ManForEachCiId( p, Id, i )
-        Cec4_ObjSimCi( p, Id );
+        Cec4_ObjSimCi( p, pMan, Id );
     p->iPatsPi = 0;
 }
 void Cec4_ManClearCis( Gia_Man_t * p )
@@ -1267,7 +1288,11 @@ static inline int Cec4_ObjFan1IsImpliedValue( Gia_Obj_t * pObj, int v )
 {
     return Gia_ObjIsAnd(Gia_ObjFanin1(pObj)) && Cec4_ObjObjIsImpliedValue( Gia_ObjFanin1(pObj), v ^ Gia_ObjFaninC1(pObj) );
 }
-int Cec4_ManGeneratePatterns_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Vec_Int_t * vPat, Vec_Int_t * vVisit )
+static inline int Cec4_ManRandomBit( Cec4_Man_t * pMan )
+{
+    return (pMan ? Cec4_ManRandom(pMan) : Abc_Random(0)) & 1;
+}
+static int Cec4_ManGeneratePatternsInt_rec( Gia_Man_t * p, Cec4_Man_t * pMan, Gia_Obj_t * pObj, int Value, Vec_Int_t * vPat, Vec_Int_t * vVisit )
 {
     Gia_Obj_t * pFan0, * pFan1;
     assert( !pObj->fMark0 && !pObj->fMark1 ); // not visited
@@ -1291,27 +1316,27 @@ int Cec4_ManGeneratePatterns_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Ve
         if ( Ass0 )
         {
             int ValueInt = Value ^ Cec4_ObjFan0HasValue(pObj, 1);
-            if ( !Cec4_ManGeneratePatterns_rec(p, pFan1, ValueInt, vPat, vVisit) )
+            if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, ValueInt, vPat, vVisit) )
                 return 0;
         }
         else if ( Ass1 )
         {
             int ValueInt = Value ^ Cec4_ObjFan1HasValue(pObj, 1);
-            if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, ValueInt, vPat, vVisit) )
+            if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, ValueInt, vPat, vVisit) )
                 return 0;
         }
-        else if ( Abc_Random(0) & 1 )
+        else if ( Cec4_ManRandomBit(pMan) )
         {
-            if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, 0,      vPat, vVisit) )
+            if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, 0,      vPat, vVisit) )
                 return 0;
-            if ( Cec4_ObjFan1HasValue(pObj, !Value) || (!Cec4_ObjFan1HasValue(pObj, Value) && !Cec4_ManGeneratePatterns_rec(p, pFan1, Value,  vPat, vVisit)) )
+            if ( Cec4_ObjFan1HasValue(pObj, !Value) || (!Cec4_ObjFan1HasValue(pObj, Value) && !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, Value,  vPat, vVisit)) )
                 return 0;
         }
         else
         {
-            if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, 1,      vPat, vVisit) )
+            if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, 1,      vPat, vVisit) )
                 return 0;
-            if ( Cec4_ObjFan1HasValue(pObj, Value) || (!Cec4_ObjFan1HasValue(pObj, !Value) && !Cec4_ManGeneratePatterns_rec(p, pFan1, !Value, vPat, vVisit)) )
+            if ( Cec4_ObjFan1HasValue(pObj, Value) || (!Cec4_ObjFan1HasValue(pObj, !Value) && !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, !Value, vPat, vVisit)) )
                 return 0;
         }
         assert( Value == (Cec4_ObjFan0HasValue(pObj, 1) ^ Cec4_ObjFan1HasValue(pObj, 1)) );
@@ -1321,9 +1346,9 @@ int Cec4_ManGeneratePatterns_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Ve
     {
         if ( Cec4_ObjFan0HasValue(pObj, 0) || Cec4_ObjFan1HasValue(pObj, 0) )
             return 0;
-        if ( !Cec4_ObjFan0HasValue(pObj, 1) && !Cec4_ManGeneratePatterns_rec(p, pFan0, !Gia_ObjFaninC0(pObj), vPat, vVisit) )
+        if ( !Cec4_ObjFan0HasValue(pObj, 1) && !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, !Gia_ObjFaninC0(pObj), vPat, vVisit) )
             return 0;
-        if ( !Cec4_ObjFan1HasValue(pObj, 1) && !Cec4_ManGeneratePatterns_rec(p, pFan1, !Gia_ObjFaninC1(pObj), vPat, vVisit) )
+        if ( !Cec4_ObjFan1HasValue(pObj, 1) && !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, !Gia_ObjFaninC1(pObj), vPat, vVisit) )
             return 0;
         assert( Cec4_ObjFan0HasValue(pObj, 1) && Cec4_ObjFan1HasValue(pObj, 1) );
         return 1;
@@ -1336,44 +1361,44 @@ int Cec4_ManGeneratePatterns_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Ve
             return 1;
         if ( Cec4_ObjFan0HasValue(pObj, 1) )
         {
-            if ( !Cec4_ManGeneratePatterns_rec(p, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
+            if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
                 return 0;
         }
         else if ( Cec4_ObjFan1HasValue(pObj, 1) )
         {
-            if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
+            if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
                 return 0;
         }
         else
         {
             if ( Cec4_ObjFan0IsImpliedValue( pObj, 0 ) )
             {
-                if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
+                if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
                     return 0;
             }
             else if ( Cec4_ObjFan1IsImpliedValue( pObj, 0 ) )
             {
-                if ( !Cec4_ManGeneratePatterns_rec(p, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
+                if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
                     return 0;
             }
             else if ( Cec4_ObjFan0IsImpliedValue( pObj, 1 ) )
             {
-                if ( !Cec4_ManGeneratePatterns_rec(p, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
+                if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
                     return 0;
             }
             else if ( Cec4_ObjFan1IsImpliedValue( pObj, 1 ) )
             {
-                if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
+                if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
                     return 0;
             }
-            else if ( Abc_Random(0) & 1 )
+            else if ( Cec4_ManRandomBit(pMan) )
             {
-                if ( !Cec4_ManGeneratePatterns_rec(p, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
+                if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan1, Gia_ObjFaninC1(pObj), vPat, vVisit) )
                     return 0;
             }
             else
             {
-                if ( !Cec4_ManGeneratePatterns_rec(p, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
+                if ( !Cec4_ManGeneratePatternsInt_rec(p, pMan, pFan0, Gia_ObjFaninC0(pObj), vPat, vVisit) )
                     return 0;
             }
         }
@@ -1381,8 +1406,13 @@ int Cec4_ManGeneratePatterns_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Ve
         return 1;
     }
 }
-int Cec4_ManGeneratePatternOne( Gia_Man_t * p, int iRepr, int iReprVal, int iCand, int iCandVal, Vec_Int_t * vPat, Vec_Int_t * vVisit )
+int Cec4_ManGeneratePatterns_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int Value, Vec_Int_t * vPat, Vec_Int_t * vVisit )
+{
+    return Cec4_ManGeneratePatternsInt_rec( p, NULL, pObj, Value, vPat, vVisit );
+}
+int Cec4_ManGeneratePatternOne( Cec4_Man_t * pMan, int iRepr, int iReprVal, int iCand, int iCandVal, Vec_Int_t * vPat, Vec_Int_t * vVisit )
 {
+    Gia_Man_t * p = pMan->pAig;
     int Res, k;
     Gia_Obj_t * pObj;
     assert( iCand > 0 );
@@ -1392,7 +1422,7 @@ int Cec4_ManGeneratePatternOne( Gia_Man_t * p, int iRepr, int iReprVal, int iCan
     Vec_IntClear( vVisit );
     //Gia_ManForEachObj( p, pObj, k )
     //    assert( !pObj->fMark0 && !pObj->fMark1 );
-    Res = (!iRepr || Cec4_ManGeneratePatterns_rec(p, Gia_ManObj(p, iRepr), iReprVal, vPat, vVisit)) && Cec4_ManGeneratePatterns_rec(p, Gia_ManObj(p, iCand), iCandVal, vPat, vVisit);
+    Res = (!iRepr || Cec4_ManGeneratePatternsInt_rec(p, pMan, Gia_ManObj(p, iRepr), iReprVal, vPat, vVisit)) && Cec4_ManGeneratePatternsInt_rec(p, pMan, Gia_ManObj(p, iCand), iCandVal, vPat, vVisit);
     Gia_ManForEachObjVec( vVisit, p, pObj, k )
         pObj->fMark0 = pObj->fMark1 = 0;
     return Res;
@@ -1409,7 +1439,7 @@ void Cec4_ManCandIterStart( Cec4_Man_t * p )
     pArray = Vec_IntArray( p->vCands );
     for ( i = 0; i < Vec_IntSize(p->vCands); i++ )
     {
-        int iNew = Abc_Random(0) % Vec_IntSize(p->vCands);
+        int iNew = Cec4_ManRandom(p) % Vec_IntSize(p->vCands);
         ABC_SWAP( int, pArray[i], pArray[iNew] );
     }
 }
@@ -1450,9 +1480,9 @@ int Cec4_ManGeneratePatterns( Cec4_Man_t * p )
             int iRepr    = Gia_ObjRepr( p->pAig, iCand );
             int iCandVal = Gia_ManObj(p->pAig, iCand)->fPhase;
             int iReprVal = Gia_ManObj(p->pAig, iRepr)->fPhase;
-            int Res = Cec4_ManGeneratePatternOne( p->pAig, iRepr,  iReprVal, iCand, !iCandVal, p->vPat, p->vVisit );
+            int Res = Cec4_ManGeneratePatternOne( p, iRepr,  iReprVal, iCand, !iCandVal, p->vPat, p->vVisit );
             if ( !Res )
-                Res = Cec4_ManGeneratePatternOne( p->pAig, iRepr, !iReprVal, iCand,  iCandVal, p->vPat, p->vVisit );
+                Res = Cec4_ManGeneratePatternOne( p, iRepr, !iReprVal, iCand,  iCandVal, p->vPat, p->vVisit );
             if ( Res )
             {
                 int Ret = Cec4_ManPackAddPattern( p->pAig, p->vPat, 1 );
@@ -1778,7 +1808,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         assert( Gia_ObjId(p, pObj) == i+1 );
 
     // check if any output trivially fails under all-0 pattern
-    Abc_Random( 1 );
+    Cec4_ManRandomReset( pMan );
+    Cec4_ManRandom( pMan );
     Gia_ManSetPhase( p );
     if ( pPars->nLevelMax )
         Gia_ManLevelNum(p);
@@ -1795,7 +1826,7 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
 
     // simulate one round and create classes
     Cec4_ManSimAlloc( p, pPars->nWords );
-    Cec4_ManSimulateCis( p );
+    Cec4_ManSimulateCis( p, pMan );
     Cec4_ManSimulate( p, pMan );
     if ( pPars->fCheckMiter && !Cec4_ManSimulateCos(p) ) // cex detected
         goto finalize;
@@ -1805,7 +1836,7 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     // perform simulation
     for ( i = 0; i < pPars->nRounds; i++ )
     {
-        Cec4_ManSimulateCis( p );
+        Cec4_ManSimulateCis( p, pMan );
         Cec4_ManSimulate( p, pMan );
         if ( pPars->fCheckMiter && !Cec4_ManSimulateCos(p) ) // cex detected
             goto finalize;
@@ -1819,7 +1850,7 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     Cec4_ManCandIterStart( pMan );
     for ( i = 0; fSimulate && i < pPars->nGenIters; i++ )
     {
-        Cec4_ManSimulateCis( p );
+        Cec4_ManSimulateCis( p, pMan );
         fSimulate = Cec4_ManGeneratePatterns( pMan );
         Cec4_ManSimulate( p, pMan );
         if ( pPars->fCheckMiter && !Cec4_ManSimulateCos(p) ) // cex detected
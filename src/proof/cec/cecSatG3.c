@@ -22,6 +22,7 @@
 #include "misc/util/utilTruth.h"
 #include "cec.h"
 #include "aig/gia/giaCSatP.h"
+#include "misc/util/utilPth.h"
 #include <stdlib.h>
 
 #define USE_GLUCOSE2
@@ -112,6 +113,8 @@ struct Cec5_Man_t_
     Vec_Int_t *      vRefBins;
     int *            pTable;
     int              nTableSize;
+    // multi-threaded simulation
+    Vec_Wec_t *      vSimLevels;     // AND nodes by level (NULL if words are split)
     // statistics
     int              nItersSim;
     int              nItersSat;
@@ -232,6 +235,7 @@ void Cec5_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nThreads       =       1;    // the number of simulation threads
 }
 
 /**Function*************************************************************
@@ -279,6 +283,7 @@ Cec5_Man_t * Cec5_ManCreate( Gia_Man_t * pAig, Cec_ParFra_t * pPars )
     p->simBatchFactor= 1;
     p->simGlobalTop  = 0;
     p->adaRecycle    = 500;
+    p->vSimLevels    = Gia_ManSimParLevels( pAig, pPars->nWords, pPars->nThreads );
     if ( pPars->nBTLimitPo )
     {
         int i, Driver;
@@ -336,6 +341,7 @@ void Cec5_ManDestroy( Cec5_Man_t * p )
     Vec_IntFreeP( &p->vRefBins );
     Vec_IntFreeP( &p->vPiPatsCache );
     Vec_BitFreeP( &p->vCexSite );
+    Vec_WecFreeP( &p->vSimLevels );
     ABC_FREE( p->pTable );
     ABC_FREE( p );
 }
@@ -878,7 +884,7 @@ static inline void Cec5_ObjSimCo( Gia_Man_t * p, int iObj )
         for ( w = 0; w < p->nSimWords; w++ )
             pSimCo[w] =  pSimDri[w];
 }
-static inline void Cec5_ObjSimAnd( Gia_Man_t * p, Cec5_Man_t * pMan, int iObj )
+static inline void Cec5_ObjSimAndRange( Gia_Man_t * p, int iObj, int wStart, int wStop )
 {
     int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
@@ -886,19 +892,19 @@ static inline void Cec5_ObjSimAnd( Gia_Man_t * p, Cec5_Man_t * pMan, int iObj )
     word * pSim0 = Cec5_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec5_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
     if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = pMan->simStart; w < pMan->simBound; w++ )
+        for ( w = wStart; w < wStop; w++ )
             pSim[w] = ~pSim0[w] & ~pSim1[w];
     else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = pMan->simStart; w < pMan->simBound; w++ )
+        for ( w = wStart; w < wStop; w++ )
             pSim[w] = ~pSim0[w] & pSim1[w];
     else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = pMan->simStart; w < pMan->simBound; w++ )
+        for ( w = wStart; w < wStop; w++ )
             pSim[w] = pSim0[w] & ~pSim1[w];
     else
-        for ( w = pMan->simStart; w < pMan->simBound; w++ )
+        for ( w = wStart; w < wStop; w++ )
             pSim[w] = pSim0[w] & pSim1[w];
 }
-static inline void Cec5_ObjSimXor( Gia_Man_t * p, Cec5_Man_t * pMan, int iObj )
+static inline void Cec5_ObjSimXorRange( Gia_Man_t * p, int iObj, int wStart, int wStop )
 {
     int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
@@ -906,12 +912,20 @@ static inline void Cec5_ObjSimXor( Gia_Man_t * p, Cec5_Man_t * pMan, int iObj )
     word * pSim0 = Cec5_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec5_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
     if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
-        for ( w = pMan->simStart; w < pMan->simBound; w++ )
+        for ( w = wStart; w < wStop; w++ )
             pSim[w] = ~pSim0[w] ^ pSim1[w];
     else
-        for ( w = pMan->simStart; w < pMan->simBound; w++ )
+        for ( w = wStart; w < wStop; w++ )
             pSim[w] =  pSim0[w] ^ pSim1[w];
 }
+static inline void Cec5_ObjSimAnd( Gia_Man_t * p, Cec5_Man_t * pMan, int iObj )
+{
+    Cec5_ObjSimAndRange( p, iObj, pMan->simStart, pMan->simBound );
+}
+static inline void Cec5_ObjSimXor( Gia_Man_t * p, Cec5_Man_t * pMan, int iObj )
+{
+    Cec5_ObjSimXorRange( p, iObj, pMan->simStart, pMan->simBound );
+}
 static inline void Cec5_ObjSimCi( Gia_Man_t * p, int iObj )
 {
     int w;
@@ -968,6 +982,43 @@ int Cec5_ManSimulateCos( Gia_Man_t * p )
     }
     return 1;
 }
+static void Cec5_ManSimulateTask( void * pUser, int * pObjs, int nObjs, int wStart, int wStop )
+{
+    Cec5_Man_t * pMan = (Cec5_Man_t *)pUser;
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj; int i;
+    wStart += pMan->simStart;
+    wStop  += pMan->simStart;
+    if ( pObjs == NULL )
+    {
+        Gia_ManForEachAnd( p, pObj, i )
+            if ( Gia_ObjIsXor(pObj) )
+                Cec5_ObjSimXorRange( p, i, wStart, wStop );
+            else
+                Cec5_ObjSimAndRange( p, i, wStart, wStop );
+        return;
+    }
+    for ( i = 0; i < nObjs; i++ )
+        if ( Gia_ObjIsXor(Gia_ManObj(p, pObjs[i])) )
+            Cec5_ObjSimXorRange( p, pObjs[i], wStart, wStop );
+        else
+            Cec5_ObjSimAndRange( p, pObjs[i], wStart, wStop );
+}
+void Cec5_ManSimulatePar( Gia_Man_t * p, Cec5_Man_t * pMan )
+{
+    int i;
+    assert( p == pMan->pAig );
+    // simulate all nodes first, then collect the refined classes in the same order
+    Gia_SimParRun( pMan->vSimLevels, pMan->simBound - pMan->simStart, pMan->pPars->nThreads, Cec5_ManSimulateTask, pMan );
+    Gia_ManForEachAndId( p, i )
+    {
+        int iRepr = Gia_ObjRepr( p, i );
+        if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec5_ObjSimEqual(p, iRepr, i) )
+            continue;
+        p->pReprs[iRepr].fColorA = 1;
+        Vec_IntPush( pMan->vRefClasses, iRepr );
+    }
+}
 void Cec5_ManSimulate( Gia_Man_t * p, Cec5_Man_t * pMan )
 {
     abctime clk = Abc_Clock();
@@ -979,17 +1030,22 @@ void Cec5_ManSimulate( Gia_Man_t * p, Cec5_Man_t * pMan )
         assert( Vec_IntSize(pMan->vRefClasses) == 0 );
 
     pMan->simStart = pMan->simGlobalTop;
-    Gia_ManForEachAnd( p, pObj, i )
+    if ( pMan->pPars->nThreads > 1 )
+        Cec5_ManSimulatePar( p, pMan );
+    else
     {
-        int iRepr = Gia_ObjRepr( p, i );
-        if ( Gia_ObjIsXor(pObj) )
-            Cec5_ObjSimXor( p, pMan, i );
-        else
-            Cec5_ObjSimAnd( p, pMan, i );
-        if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec5_ObjSimEqual(p, iRepr, i) )
-            continue;
-        p->pReprs[iRepr].fColorA = 1;
-        Vec_IntPush( pMan->vRefClasses, iRepr );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            int iRepr = Gia_ObjRepr( p, i );
+            if ( Gia_ObjIsXor(pObj) )
+                Cec5_ObjSimXor( p, pMan, i );
+            else
+                Cec5_ObjSimAnd( p, pMan, i );
+            if ( iRepr == GIA_VOID || p->pReprs[iRepr].fColorA || Cec5_ObjSimEqual(p, iRepr, i) )
+                continue;
+            p->pReprs[iRepr].fColorA = 1;
+            Vec_IntPush( pMan->vRefClasses, iRepr );
+        }
     }
     pMan->simStart = 0;
     pMan->timeSim += Abc_Clock() - clk;
@@ -1531,6 +1587,332 @@ int Cec5_ManGeneratePatterns( Cec5_Man_t * p )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping of the candidates with small cones.]
+
+  Description [Before the main sweeping loop, the candidate pairs whose
+  joint TFI cone has at most CEC5_PAR_CONE AND nodes are solved in
+  batches by several worker solvers, each loading the cones directly
+  from the user's AIG. Each batch is divided into chunks of CEC5_PAR_CHUNK
+  pairs, which do not depend on the number of threads, and each chunk is
+  solved by a fresh solver, so the outcome of a pair depends only on the
+  pair list, and the result is the same for any number of threads above
+  one, independently of the scheduling. The results are applied in the order of node IDs
+  on the calling thread: the proved nodes are marked the same way as
+  in the main loop, the counter-examples are packed into the simulation
+  patterns, which then refine the classes before the next batch. The
+  pairs that are not solved are left for the main loop. Returns 0 if
+  the miter was found to be SAT.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define CEC5_PAR_CONE      500   // the largest joint cone of a pair solved by the workers
+#define CEC5_PAR_BATCH    1024   // the largest number of pairs in one batch
+#define CEC5_PAR_ROUNDS    100   // the largest number of batches
+#define CEC5_PAR_CHUNK      32   // the number of pairs solved by one solver
+
+typedef struct Cec5_Wrk_t_ Cec5_Wrk_t;
+struct Cec5_Wrk_t_
+{
+    sat_solver *     pSat;           // the solver of this worker
+    Vec_Int_t *      vSatIds;        // SAT variables of the AIG objects (-1 if none)
+    Vec_Int_t *      vObjs;          // the objects having SAT variables
+    Vec_Int_t *      vVarMap;        // the objects of the SAT variables
+    Vec_Int_t *      vCiPairs;       // pairs (CiObjId, SatVar)
+};
+
+typedef struct Cec5_Par_t_ Cec5_Par_t;
+struct Cec5_Par_t_
+{
+    Cec5_Man_t *     pMan;           // the sweeping manager
+    Cec5_Wrk_t *     pWrks;          // the workers
+    Vec_Int_t *      vPairs;         // pairs (iRepr, iObj) of the batch
+    Vec_Int_t *      vStatus;        // the solver status of each pair
+    Vec_Wec_t *      vCexes;         // the CI literals of the disproved pairs
+};
+
+static void Cec5_WrkStart( Cec5_Wrk_t * pWrk, Gia_Man_t * p, int jType )
+{
+    pWrk->pSat     = sat_solver_start();
+    sat_solver_set_jftr( pWrk->pSat, jType );
+    pWrk->vSatIds  = Vec_IntStartFull( Gia_ManObjNum(p) );
+    pWrk->vObjs    = Vec_IntAlloc( 1000 );
+    pWrk->vVarMap  = Vec_IntAlloc( 1000 );
+    pWrk->vCiPairs = Vec_IntAlloc( 1000 );
+}
+static void Cec5_WrkStop( Cec5_Wrk_t * pWrk )
+{
+    sat_solver_stop( pWrk->pSat );
+    Vec_IntFree( pWrk->vSatIds );
+    Vec_IntFree( pWrk->vObjs );
+    Vec_IntFree( pWrk->vVarMap );
+    Vec_IntFree( pWrk->vCiPairs );
+}
+static void Cec5_WrkRecycle( Cec5_Wrk_t * pWrk )
+{
+    int i, iObj;
+    sat_solver_reset( pWrk->pSat );
+    Vec_IntForEachEntry( pWrk->vObjs, iObj, i )
+        Vec_IntWriteEntry( pWrk->vSatIds, iObj, -1 );
+    Vec_IntClear( pWrk->vObjs );
+    Vec_IntClear( pWrk->vVarMap );
+    Vec_IntClear( pWrk->vCiPairs );
+}
+static int Cec5_WrkObjSetSatVar( Cec5_Wrk_t * pWrk, Gia_Man_t * p, int iObj )
+{
+    int iVar = sat_solver_addvar( pWrk->pSat );
+    assert( Vec_IntSize(pWrk->vVarMap) == iVar );
+    Vec_IntWriteEntry( pWrk->vSatIds, iObj, iVar );
+    Vec_IntPush( pWrk->vObjs, iObj );
+    Vec_IntPush( pWrk->vVarMap, iObj );
+    if ( Gia_ObjIsCi(Gia_ManObj(p, iObj)) )
+        Vec_IntPushTwo( pWrk->vCiPairs, iObj, iVar );
+    return iVar;
+}
+// same as the simple CNF in Cec5_ObjGetCnfVar() but for the user's AIG
+static int Cec5_WrkObjGetCnfVar( Cec5_Wrk_t * pWrk, Gia_Man_t * p, int iObj, int jType )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj ), * pFan0, * pFan1;
+    int iVar, iVar0, iVar1, Lit0, Lit1;
+    if ( Vec_IntEntry(pWrk->vSatIds, iObj) >= 0 )
+        return Vec_IntEntry(pWrk->vSatIds, iObj);
+    if ( iObj == 0 || Gia_ObjIsCi(pObj) )
+        return Cec5_WrkObjSetSatVar( pWrk, p, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    if ( p->pMuxes == NULL && Gia_ObjRecognizeExor(pObj, &pFan0, &pFan1) && Gia_IsComplement(pFan0) == Gia_IsComplement(pFan1) )
+    {
+        iVar0 = Cec5_WrkObjGetCnfVar( pWrk, p, Gia_ObjId(p, Gia_Regular(pFan0)), jType );
+        iVar1 = Cec5_WrkObjGetCnfVar( pWrk, p, Gia_ObjId(p, Gia_Regular(pFan1)), jType );
+        iVar  = Cec5_WrkObjSetSatVar( pWrk, p, iObj );
+        if ( jType < 2 )
+            sat_solver_add_xor( pWrk->pSat, iVar, iVar0, iVar1, 0 );
+        if ( jType > 0 )
+        {
+            Lit0 = Abc_Var2Lit( iVar0, 0 );
+            Lit1 = Abc_Var2Lit( iVar1, 0 );
+            if ( Lit0 < Lit1 )
+                 Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+            sat_solver_set_var_fanin_lit( pWrk->pSat, iVar, Lit0, Lit1 );
+        }
+        return iVar;
+    }
+    iVar0 = Cec5_WrkObjGetCnfVar( pWrk, p, Gia_ObjFaninId0(pObj, iObj), jType );
+    iVar1 = Cec5_WrkObjGetCnfVar( pWrk, p, Gia_ObjFaninId1(pObj, iObj), jType );
+    iVar  = Cec5_WrkObjSetSatVar( pWrk, p, iObj );
+    if ( jType < 2 )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            sat_solver_add_xor( pWrk->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) );
+        else
+            sat_solver_add_and( pWrk->pSat, iVar, iVar0, iVar1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+    }
+    if ( jType > 0 )
+    {
+        Lit0 = Abc_Var2Lit( iVar0, Gia_ObjFaninC0(pObj) );
+        Lit1 = Abc_Var2Lit( iVar1, Gia_ObjFaninC1(pObj) );
+        if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
+             Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+        sat_solver_set_var_fanin_lit( pWrk->pSat, iVar, Lit0, Lit1 );
+    }
+    return iVar;
+}
+static void Cec5_ParSolvePair( Cec5_Par_t * p, Cec5_Wrk_t * pWrk, int iTask )
+{
+    Cec_ParFra_t * pPars = p->pMan->pPars;
+    Gia_Man_t * pAig = p->pMan->pAig;
+    int iRepr  = Vec_IntEntry( p->vPairs, 2*iTask );
+    int iObj   = Vec_IntEntry( p->vPairs, 2*iTask+1 );
+    int fCompl = Gia_ManObj(pAig, iRepr)->fPhase ^ Gia_ManObj(pAig, iObj)->fPhase;
+    int i, status, iVar0, iVar1, Lits[2];
+    iVar0 = Cec5_WrkObjGetCnfVar( pWrk, pAig, iRepr, pPars->jType );
+    iVar1 = Cec5_WrkObjGetCnfVar( pWrk, pAig, iObj, pPars->jType );
+    if ( pPars->jType > 0 )
+        bmcg2_sat_solver_markapprox( pWrk->pSat, iVar0, iVar1, p->pMan->approxLim );
+    // the constant node is the first variable, which is assumed to be 0 below
+    Lits[0] = Abc_Var2Lit( iVar0, 1 );
+    Lits[1] = Abc_Var2Lit( iVar1, fCompl );
+    sat_solver_set_conflict_budget( pWrk->pSat, pPars->nBTLimit );
+    status = sat_solver_solve( pWrk->pSat, Lits, 2 );
+    if ( status == GLUCOSE_UNSAT && iRepr > 0 )
+    {
+        Lits[0] = Abc_Var2Lit( iVar0, 0 );
+        Lits[1] = Abc_Var2Lit( iVar1, !fCompl );
+        sat_solver_set_conflict_budget( pWrk->pSat, pPars->nBTLimit );
+        status = sat_solver_solve( pWrk->pSat, Lits, 2 );
+    }
+    if ( status == GLUCOSE_SAT )
+    {
+        Vec_Int_t * vCex = Vec_WecEntry( p->vCexes, iTask );
+        if ( pPars->jType == 0 )
+        {
+            int IdAig, IdSat;
+            Vec_IntForEachEntryDouble( pWrk->vCiPairs, IdAig, IdSat, i )
+                Vec_IntPush( vCex, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(pWrk->pSat, IdSat)) );
+        }
+        else
+        {
+            int * pCex = sat_solver_read_cex( pWrk->pSat );
+            int * pMap = Vec_IntArray( pWrk->vVarMap );
+            for ( i = 0; i < pCex[0]; )
+                Vec_IntPush( vCex, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+        }
+    }
+    Vec_IntWriteEntry( p->vStatus, iTask, status );
+}
+static void Cec5_ParSolveTask( void * pArg, int iChunk, int iThread )
+{
+    Cec5_Par_t * p = (Cec5_Par_t *)pArg;
+    Cec5_Wrk_t * pWrk = p->pWrks + iThread;
+    int k, nPairs = Vec_IntSize(p->vPairs) / 2;
+    // the solver starts empty for each chunk
+    Cec5_WrkRecycle( pWrk );
+    for ( k = iChunk * CEC5_PAR_CHUNK; k < Abc_MinInt(nPairs, (iChunk + 1) * CEC5_PAR_CHUNK); k++ )
+        Cec5_ParSolvePair( p, pWrk, k );
+}
+static void Cec5_ManConeCount_rec( Gia_Man_t * p, int iObj, int * pCount, int nLimit )
+{
+    Gia_Obj_t * pObj;
+    if ( *pCount > nLimit || Gia_ObjIsTravIdCurrentId(p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId( p, iObj );
+    pObj = Gia_ManObj( p, iObj );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return;
+    (*pCount)++;
+    Cec5_ManConeCount_rec( p, Gia_ObjFaninId0(pObj, iObj), pCount, nLimit );
+    Cec5_ManConeCount_rec( p, Gia_ObjFaninId1(pObj, iObj), pCount, nLimit );
+}
+static int Cec5_ManConeCount( Gia_Man_t * p, int iObj0, int iObj1, int nLimit )
+{
+    int Count = 0;
+    Gia_ManIncrementTravId( p );
+    Cec5_ManConeCount_rec( p, iObj0, &Count, nLimit );
+    Cec5_ManConeCount_rec( p, iObj1, &Count, nLimit );
+    return Count;
+}
+int Cec5_ManSweepPar( Cec5_Man_t * pMan, int * pMerged )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Cec5_Par_t Par, * pPar = &Par;
+    Vec_Bit_t * vLarge = Vec_BitStart( Gia_ManObjNum(p) );
+    Vec_Bit_t * vSkip  = Vec_BitStart( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj;
+    int nWrks = Abc_MinInt( pMan->pPars->nThreads, UTIL_PTH_MAX );
+    int i, k, r, iObj, iRepr, nPairs, nSat, fFull, RetValue = 1;
+    int nAll = 0, nProved = 0, nDisproved = 0, nUndec = 0;
+    abctime clk = Abc_Clock();
+    // mark the nodes whose cones are too large; their fanouts have larger cones
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( Vec_BitEntry(vLarge, Gia_ObjFaninId0(pObj, i)) || Vec_BitEntry(vLarge, Gia_ObjFaninId1(pObj, i)) || 
+             Cec5_ManConeCount(p, i, i, CEC5_PAR_CONE) > CEC5_PAR_CONE )
+            Vec_BitWriteEntry( vLarge, i, 1 );
+    memset( pPar, 0, sizeof(Cec5_Par_t) );
+    pPar->pMan    = pMan;
+    pPar->pWrks   = ABC_CALLOC( Cec5_Wrk_t, nWrks );
+    pPar->vPairs  = Vec_IntAlloc( 2 * CEC5_PAR_BATCH );
+    pPar->vStatus = Vec_IntAlloc( CEC5_PAR_BATCH );
+    pPar->vCexes  = Vec_WecAlloc( CEC5_PAR_BATCH );
+    for ( k = 0; k < nWrks; k++ )
+        Cec5_WrkStart( pPar->pWrks + k, p, pMan->pPars->jType );
+    for ( r = 0; r < CEC5_PAR_ROUNDS; r++ )
+    {
+        // collect the pairs in the order of node IDs
+        Vec_IntClear( pPar->vPairs );
+        Gia_ManForEachAnd( p, pObj, iObj )
+        {
+            if ( Vec_BitEntry(vLarge, iObj) || Vec_BitEntry(vSkip, iObj) || Gia_ObjProved(p, iObj) || Gia_ObjFailed(p, iObj) )
+                continue;
+            iRepr = Gia_ObjRepr( p, iObj );
+            if ( iRepr == GIA_VOID || Vec_BitEntry(vLarge, iRepr) )
+                continue;
+            if ( Cec5_ManConeCount(p, iRepr, iObj, CEC5_PAR_CONE) > CEC5_PAR_CONE )
+                continue;
+            Vec_IntPushTwo( pPar->vPairs, iRepr, iObj );
+            if ( Vec_IntSize(pPar->vPairs) == 2 * CEC5_PAR_BATCH )
+                break;
+        }
+        if ( Vec_IntSize(pPar->vPairs) == 0 )
+            break;
+        // solve them
+        nPairs = Vec_IntSize(pPar->vPairs) / 2;
+        Vec_IntFill( pPar->vStatus, nPairs, GLUCOSE_UNDEC );
+        Vec_WecInit( pPar->vCexes, nPairs );
+        Vec_WecClearLevels( pPar->vCexes );
+        Util_PthRun( nWrks, (nPairs + CEC5_PAR_CHUNK - 1) / CEC5_PAR_CHUNK, Cec5_ParSolveTask, pPar );
+        nAll += nPairs;
+        // apply the results
+        nSat = fFull = 0;
+        for ( k = 0; k < nPairs; k++ )
+        {
+            int status = Vec_IntEntry( pPar->vStatus, k );
+            Vec_Int_t * vCex = Vec_WecEntry( pPar->vCexes, k );
+            iRepr = Vec_IntEntry( pPar->vPairs, 2*k );
+            iObj  = Vec_IntEntry( pPar->vPairs, 2*k+1 );
+            if ( status == GLUCOSE_UNSAT )
+            {
+                assert( !Gia_ObjProved(p, iObj) );
+                Gia_ObjSetProved( p, iObj );
+                pMerged[iObj] = iRepr;
+                if ( iRepr == 0 )
+                    pMan->iLastConst = iObj;
+                pMan->nSatUnsat++;
+                nProved++;
+            }
+            else if ( status == GLUCOSE_UNDEC )
+            {
+                Vec_BitWriteEntry( vSkip, iObj, 1 );
+                nUndec++;
+            }
+            else if ( !fFull ) // the pairs not packed are solved again in the next batch
+            {
+                if ( nSat++ == 0 )
+                {
+                    Cec5_ManSimulateCis( p );
+                    p->iPatsPi = 0;
+                    Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+                }
+                if ( Cec5_ManPackAddPattern(p, vCex, 1) == 64 * p->nSimWords )
+                    fFull = 1;
+                if ( p->vPats )
+                {
+                    Vec_IntPush( p->vPats, Vec_IntSize(vCex)+2 );
+                    Vec_IntAppend( p->vPats, vCex );
+                    Vec_IntPush( p->vPats, -1 );
+                }
+                nDisproved++;
+            }
+        }
+        if ( nSat == 0 )
+            continue;
+        Cec5_ManSimulate( p, pMan );
+        if ( pMan->pPars->fCheckMiter && !Cec5_ManSimulateCos(p) ) // cex detected
+        {
+            RetValue = 0;
+            break;
+        }
+    }
+    for ( k = 0; k < nWrks; k++ )
+        Cec5_WrkStop( pPar->pWrks + k );
+    ABC_FREE( pPar->pWrks );
+    Vec_IntFree( pPar->vPairs );
+    Vec_IntFree( pPar->vStatus );
+    Vec_WecFree( pPar->vCexes );
+    Vec_BitFree( vLarge );
+    Vec_BitFree( vSkip );
+    if ( pMan->pPars->fVerbose )
+    {
+        printf( "Parallel sweeping with %d threads: Batches = %d. Pairs = %d.  P = %d. D = %d. F = %d.  ", 
+            nWrks, r, nAll, nProved, nDisproved, nUndec );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        Cec5_ManPrintStats( p, pMan->pPars, pMan, 1 );
+    }
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Internal simulation APIs.]
@@ -1962,6 +2344,13 @@ int Cec5_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
 
     vMerged = ABC_FALLOC(int, Gia_ManObjNum(p)); // refinement may move non-repr merge around . record the true merged performed
 
+    // solve the pairs with small cones on several threads
+    if ( pPars->nThreads > 1 && Util_PthEnabled() && !Cec5_ManSweepPar(pMan, vMerged) )
+    {
+        ABC_FREE( vMerged );
+        goto finalize;
+    }
+
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
@@ -2323,7 +2712,7 @@ int Cec5_ManSweepNodeCbs( Cec5_Man_t * p, CbsP_Man_t * pCbs, int iObj, int iRepr
     }
     return RetValue;
 }
-Gia_Man_t * Cec5_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
+Gia_Man_t * Cec5_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int nThreads, int fVerbose )
 {
     int fCbs = 1, approxLim = 600, subBatchSz = 1, adaRecycle = 500;
     Gia_Man_t * pNew = NULL;
@@ -2331,6 +2720,7 @@ Gia_Man_t * Cec5_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
     Cec5_ManSetParams( pPars );
     pPars->fVerbose = fVerbose;
     pPars->nBTLimit = nBTLimit;
+    pPars->nThreads = nThreads;
     Cec5_ManPerformSweeping( p, pPars, &pNew, 0, fCbs, approxLim, subBatchSz, adaRecycle );
     return pNew;
 }
@@ -24,6 +24,8 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilPth.h"
+#include "cec.h"
 //#include "bdd/cudd/cuddInt.h"
 
 #ifdef ABC_USE_PTHREADS
@@ -44,9 +46,12 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+extern int Cec_GiaSplitCones( Gia_Man_t * p, int nProcs, int nPartSize, int nConfLimit, int fVerbose, int fSilent );
+
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+// case-splitting is not available; prove the miter by cone partitioning
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return Cec_GiaSplitCones( p, nProcs, 10000, 1000, fVerbose, fSilent ); }
 
 #else // pthreads are used
 
@@ -840,6 +845,323 @@ void Cec_GiaPrintCofStats2( Gia_Man_t * p )
 
 #endif // pthreads are used
 
+////////////////////////////////////////////////////////////////////////
+///                  CONE-PARTITIONED PARALLEL CEC                   ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Cec_SplitPart_t_ Cec_SplitPart_t;
+struct Cec_SplitPart_t_
+{
+    Gia_Man_t *      pGia;           // the sub-miter of this partition
+    Vec_Int_t *      vCis;           // the miter CIs of the sub-miter CIs
+    Vec_Int_t *      vMap;           // the miter objects of the sub-miter objects (-1 if none)
+    int              nAnds;          // the number of AND nodes before sweeping
+    int              Status;         // 1 = proved, 0 = disproved, -1 = undecided
+    int              nProved;        // the number of outputs proved
+    abctime          Time;           // the runtime of this partition
+};
+
+typedef struct Cec_SplitMan_t_ Cec_SplitMan_t;
+struct Cec_SplitMan_t_
+{
+    Cec_SplitPart_t* pParts;         // the partitions of the current wave
+    int              nConfLimit;     // the conflict limit of the sweeper
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Groups the outputs into partitions.]
+
+  Description [The outputs are visited in order, so that the neighboring 
+  outputs, which often share logic, are placed together. A partition is
+  closed as soon as its cone has at least nPartSize AND nodes. The 
+  outputs driven by constant 0 are skipped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitConeCount_rec( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_ObjUpdateTravIdCurrentId(p, iObj) )
+        return 0;
+    pObj = Gia_ManObj( p, iObj );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    return 1 + Cec_GiaSplitConeCount_rec( p, Gia_ObjFaninId0(pObj, iObj) ) + Cec_GiaSplitConeCount_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+}
+Vec_Wec_t * Cec_GiaSplitPartition( Gia_Man_t * p, int nPartSize )
+{
+    Vec_Wec_t * vParts = Vec_WecAlloc( 100 );
+    Vec_Int_t * vPart = NULL;
+    Gia_Obj_t * pObj;
+    int i, nSize = 0;
+    Gia_ManForEachPo( p, pObj, i )
+    {
+        if ( Gia_ObjFaninLit0p(p, pObj) == 0 )
+            continue;
+        if ( vPart == NULL || nSize >= nPartSize )
+        {
+            vPart = Vec_WecPushLevel( vParts );
+            Gia_ManIncrementTravId( p );
+            Gia_ObjSetTravIdCurrentId( p, 0 );
+            nSize = 0;
+        }
+        nSize += Cec_GiaSplitConeCount_rec( p, Gia_ObjFaninId0p(p, pObj) );
+        Vec_IntPush( vPart, i );
+    }
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the sub-miter of one partition.]
+
+  Description [Each node is replaced by the smallest node proved 
+  equivalent to it (pRoots), so that the logic merged in the previous
+  partitions is not proved again. Only the CIs in the cone are kept,
+  in the order of the miter CIs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_GiaSplitRoot( int * pRoots, int iObj )
+{
+    while ( pRoots[iObj] != iObj )
+        iObj = pRoots[iObj] = pRoots[pRoots[iObj]];
+    return iObj;
+}
+static inline int Cec_GiaSplitCopy( Gia_Man_t * p, int * pRoots, int iObj, int fCompl )
+{
+    int iRoot = Cec_GiaSplitRoot( pRoots, iObj );
+    return Abc_LitNotCond( Gia_ManObj(p, iRoot)->Value, fCompl ^ Gia_ManObj(p, iObj)->fPhase ^ Gia_ManObj(p, iRoot)->fPhase );
+}
+void Cec_GiaSplitCollect_rec( Gia_Man_t * p, int * pRoots, int iObj, Vec_Int_t * vCis, Vec_Int_t * vAnds )
+{
+    Gia_Obj_t * pObj;
+    iObj = Cec_GiaSplitRoot( pRoots, iObj );
+    if ( Gia_ObjUpdateTravIdCurrentId(p, iObj) )
+        return;
+    pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Vec_IntPush( vCis, iObj );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec_GiaSplitCollect_rec( p, pRoots, Gia_ObjFaninId0(pObj, iObj), vCis, vAnds );
+    Cec_GiaSplitCollect_rec( p, pRoots, Gia_ObjFaninId1(pObj, iObj), vCis, vAnds );
+    Vec_IntPush( vAnds, iObj );
+}
+void Cec_GiaSplitDerive( Gia_Man_t * p, int * pRoots, Vec_Int_t * vPos, Cec_SplitPart_t * pPart )
+{
+    Vec_Int_t * vAnds = Vec_IntAlloc( 1000 );
+    Gia_Obj_t * pObj;
+    int i, iObj, iPo;
+    pPart->vCis = Vec_IntAlloc( 100 );
+    Gia_ManIncrementTravId( p );
+    Gia_ObjSetTravIdCurrentId( p, 0 );
+    Vec_IntForEachEntry( vPos, iPo, i )
+        Cec_GiaSplitCollect_rec( p, pRoots, Gia_ObjFaninId0p(p, Gia_ManPo(p, iPo)), pPart->vCis, vAnds );
+    Vec_IntSort( pPart->vCis, 0 );
+    pPart->pGia = Gia_ManStart( 1 + Vec_IntSize(pPart->vCis) + Vec_IntSize(vAnds) + Vec_IntSize(vPos) );
+    pPart->pGia->pName = Abc_UtilStrsav( p->pName );
+    pPart->vMap = Vec_IntStartFull( 1 + Vec_IntSize(pPart->vCis) + Vec_IntSize(vAnds) );
+    Vec_IntWriteEntry( pPart->vMap, 0, 0 );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachObjVec( pPart->vCis, p, pObj, i )
+    {
+        pObj->Value = Gia_ManAppendCi( pPart->pGia );
+        Vec_IntWriteEntry( pPart->vMap, Abc_Lit2Var(pObj->Value), Gia_ObjId(p, pObj) );
+    }
+    Gia_ManHashAlloc( pPart->pGia );
+    Vec_IntForEachEntry( vAnds, iObj, i )
+    {
+        pObj = Gia_ManObj( p, iObj );
+        pObj->Value = Gia_ManHashAnd( pPart->pGia, Cec_GiaSplitCopy(p, pRoots, Gia_ObjFaninId0(pObj, iObj), Gia_ObjFaninC0(pObj)), 
+                                                   Cec_GiaSplitCopy(p, pRoots, Gia_ObjFaninId1(pObj, iObj), Gia_ObjFaninC1(pObj)) );
+        if ( Vec_IntEntry(pPart->vMap, Abc_Lit2Var(pObj->Value)) == -1 )
+            Vec_IntWriteEntry( pPart->vMap, Abc_Lit2Var(pObj->Value), iObj );
+    }
+    Gia_ManHashStop( pPart->pGia );
+    Vec_IntForEachEntry( vPos, iPo, i )
+    {
+        pObj = Gia_ManPo( p, iPo );
+        Gia_ManAppendCo( pPart->pGia, Cec_GiaSplitCopy(p, pRoots, Gia_ObjFaninId0p(p, pObj), Gia_ObjFaninC0(pObj)) );
+    }
+    pPart->nAnds = Gia_ManAndNum( pPart->pGia );
+    Vec_IntFree( vAnds );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sweeps the sub-miter of one partition.]
+
+  Description [After the sweeping, the sub-miter nodes merged by the
+  sweeper have the same variable in their copy literals, and the outputs
+  proved constant 0 have drivers with copy literal 0.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_GiaSplitSolveTask( void * pArg, int iTask, int iThread )
+{
+    extern void Cec4_ManSetParams( Cec_ParFra_t * pPars );
+    extern int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly );
+    Cec_SplitMan_t * p = (Cec_SplitMan_t *)pArg;
+    Cec_SplitPart_t * pPart = p->pParts + iTask;
+    Cec_ParFra_t ParsFra, * pPars = &ParsFra;
+    Gia_Man_t * pNew = NULL;
+    Gia_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int i;
+    Cec4_ManSetParams( pPars );
+    pPars->nBTLimit    = p->nConfLimit;
+    pPars->fCheckMiter = 1;
+    Cec4_ManPerformSweeping( pPart->pGia, pPars, &pNew, 0 );
+    Gia_ManStopP( &pNew );
+    if ( pPart->pGia->pCexSeq )
+        pPart->Status = 0;
+    else
+    {
+        Gia_ManForEachCo( pPart->pGia, pObj, i )
+            pPart->nProved += (Gia_ObjFanin0Copy(pObj) == 0);
+        pPart->Status = pPart->nProved == Gia_ManCoNum(pPart->pGia) ? 1 : -1;
+    }
+    pPart->Time = Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the miter by sweeping the cones of output groups.]
+
+  Description [The outputs of the combinational miter are grouped into 
+  partitions with bounded cones (see Cec_GiaSplitPartition). The 
+  partitions are swept in waves of nProcs, one partition per thread. 
+  After each wave, the nodes merged by the sweeper are recorded as 
+  equivalent in the miter, and the partitions of the next waves are 
+  derived from the reduced logic. Returns 1 if all outputs are proved 
+  constant 0, 0 if a counter-example is found (it is stored in 
+  p->pCexComb), and -1 otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitCones( Gia_Man_t * p, int nProcs, int nPartSize, int nConfLimit, int fVerbose, int fSilent )
+{
+    Cec_SplitMan_t Man, * pMan = &Man;
+    Cec_SplitPart_t * pPart;
+    Vec_Wec_t * vParts;
+    Vec_Int_t * vFirst;
+    Gia_Obj_t * pObj;
+    int * pRoots = ABC_ALLOC( int, Gia_ManObjNum(p) );
+    int i, k, w, iObj, iVar, nWave, nMerged = 0, nProved = 0, nUndec = 0, RetValue = 1;
+    abctime clkTotal = Abc_Clock();
+    assert( Gia_ManRegNum(p) == 0 );
+    Abc_CexFreeP( &p->pCexComb );
+    Gia_ManSetPhase( p );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        pRoots[i] = i;
+    // check if an output fails under the all-0 pattern
+    Gia_ManForEachPo( p, pObj, i )
+        if ( pObj->fPhase )
+        {
+            p->pCexComb = Abc_CexAlloc( 0, Gia_ManCiNum(p), 1 );
+            p->pCexComb->iPo = i;
+            if ( !fSilent )
+                printf( "Output %d of the miter is asserted under the all-0 pattern.\n", i );
+            ABC_FREE( pRoots );
+            return 0;
+        }
+    vParts = Cec_GiaSplitPartition( p, nPartSize );
+    vFirst = Vec_IntAlloc( 1000 );
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, UTIL_PTH_MAX) );
+    if ( fVerbose )
+        printf( "Miter with %d outputs and %d AND nodes is divided into %d partitions of about %d nodes. Using %d threads.\n", 
+            Gia_ManPoNum(p), Gia_ManAndNum(p), Vec_WecSize(vParts), nPartSize, nProcs );
+    memset( pMan, 0, sizeof(Cec_SplitMan_t) );
+    pMan->pParts     = ABC_CALLOC( Cec_SplitPart_t, nProcs );
+    pMan->nConfLimit = nConfLimit;
+    for ( w = 0; RetValue && w < Vec_WecSize(vParts); w += nWave )
+    {
+        nWave = Abc_MinInt( nProcs, Vec_WecSize(vParts) - w );
+        for ( k = 0; k < nWave; k++ )
+            Cec_GiaSplitDerive( p, pRoots, Vec_WecEntry(vParts, w + k), pMan->pParts + k );
+        Util_PthRun( nProcs, nWave, Cec_GiaSplitSolveTask, pMan );
+        for ( k = 0; k < nWave; k++ )
+        {
+            pPart = pMan->pParts + k;
+            if ( fVerbose )
+            {
+                printf( "Part %5d :  PO =%7d  PI =%7d  AND =%9d  Proved =%7d  ", 
+                    w + k, Gia_ManPoNum(pPart->pGia), Gia_ManPiNum(pPart->pGia), pPart->nAnds, pPart->nProved );
+                printf( "%-10s", pPart->Status == 1 ? "UNSAT" : pPart->Status == 0 ? "SAT" : "UNDECIDED" );
+                Abc_PrintTime( 1, "Time", pPart->Time );
+            }
+            if ( pPart->Status == 0 && RetValue )
+            {
+                // map the counter-example into the miter
+                Abc_Cex_t * pCex = pPart->pGia->pCexSeq;
+                p->pCexComb = Abc_CexAlloc( 0, Gia_ManCiNum(p), 1 );
+                p->pCexComb->iPo = Vec_IntEntry( Vec_WecEntry(vParts, w + k), pCex->iPo );
+                Vec_IntForEachEntry( pPart->vCis, iObj, i )
+                    if ( Abc_InfoHasBit(pCex->pData, pCex->nRegs + i) )
+                        Abc_InfoSetBit( p->pCexComb->pData, Gia_ObjCioId(Gia_ManObj(p, iObj)) );
+                RetValue = 0;
+            }
+            else if ( pPart->Status != 0 )
+            {
+                // record the merged nodes as equivalent in the miter
+                Vec_IntFill( vFirst, 1, 0 );
+                Gia_ManForEachObj1( pPart->pGia, pObj, i )
+                {
+                    if ( Gia_ObjIsCo(pObj) || (iObj = Vec_IntEntry(pPart->vMap, i)) == -1 )
+                        continue;
+                    iVar = Abc_Lit2Var( pObj->Value );
+                    if ( Vec_IntGetEntryFull(vFirst, iVar) == -1 )
+                        Vec_IntSetEntryFull( vFirst, iVar, iObj );
+                    else
+                    {
+                        int iRoot0 = Cec_GiaSplitRoot( pRoots, Vec_IntEntry(vFirst, iVar) );
+                        int iRoot1 = Cec_GiaSplitRoot( pRoots, iObj );
+                        if ( iRoot0 != iRoot1 )
+                            pRoots[Abc_MaxInt(iRoot0, iRoot1)] = Abc_MinInt(iRoot0, iRoot1), nMerged++;
+                    }
+                }
+                nProved += pPart->nProved;
+                nUndec  += Gia_ManPoNum(pPart->pGia) - pPart->nProved;
+            }
+            Gia_ManStop( pPart->pGia );
+            Vec_IntFree( pPart->vCis );
+            Vec_IntFree( pPart->vMap );
+            memset( pPart, 0, sizeof(Cec_SplitPart_t) );
+        }
+    }
+    if ( RetValue == 1 && nUndec )
+        RetValue = -1;
+    if ( !fSilent )
+    {
+        if ( RetValue == 0 )
+            printf( "Output %d of the miter is asserted.  ", p->pCexComb->iPo );
+        else
+            printf( "Proved %d and left undecided %d outputs (merged %d nodes).  ", nProved, nUndec, nMerged );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    ABC_FREE( pMan->pParts );
+    ABC_FREE( pRoots );
+    Vec_WecFree( vParts );
+    Vec_IntFree( vFirst );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
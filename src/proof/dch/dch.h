@@ -54,6 +54,7 @@ struct Dch_Pars_t_
     int              fUseCSat;      // uses circuit-based solver
     int              fUseNew;       // uses new implementation
     int              fUseNew2;      // uses new implementation
+    int              fUseNative;    // computes choices on GIA without Aig_Man_t
     int              fLightSynth;   // uses lighter version of synthesis
     int              fSkipRedSupp;  // skip choices with redundant support vars
     int              fVerbose;      // verbose stats
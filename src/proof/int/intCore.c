@@ -196,6 +196,15 @@ p->timeEqu += Abc_Clock() - clk;
         // iterate the interpolation procedure
         for ( i = 0; ; i++ )
         {
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was cancelled by the caller.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
             if ( pPars->nFramesMax && p->nFrames + i >= pPars->nFramesMax )
             { 
                 if ( pPars->fVerbose )
@@ -264,6 +273,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // cancelled
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation was cancelled by the caller.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -50,6 +50,7 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nThreads;         // the number of worker threads
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
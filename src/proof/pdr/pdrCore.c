@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nThreads       =       1;  // the number of worker threads
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -907,6 +908,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
     while ( !Pdr_QueueIsEmpty(p) )
     {
         Counter++;
+        if ( p->pShare && Pdr_ManShareImport( p ) == -1 )
+            return -1;
         pThis = Pdr_QueueHead( p );
         if ( pThis->iFrame == 0 || (p->pPars->fUseAbs && Pdr_SetIsInit(pThis->pState, -1)) )
             return 0; // SAT
@@ -986,6 +989,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                     p->nAbsFlops++;
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
+            if ( p->pShare )
+                Pdr_ManSharePublish( p, k, pCubeMin );
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -1016,6 +1021,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
         // check termination
         if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             return -1;
+        if ( p->pShare && Pdr_ManShareStop(p) )
+            return -1;
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
             return -1;
         if ( p->timeToStopOne && Abc_Clock() > p->timeToStopOne )
@@ -1337,6 +1344,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             p->pPars->iFrame = iFrame;
             return -1;
         }
+        if ( p->pShare && Pdr_ManShareStop(p) )
+        {
+            p->pPars->iFrame = iFrame;
+            return -1;
+        }
         if ( p->timeToStop && Abc_Clock() > p->timeToStop )
         {
             if ( fPrintClauses )
@@ -1392,6 +1404,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 ***********************************************************************/
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
+    Aig_Man_t * pAigCopy;
     Pdr_Man_t * p;
     int k, RetValue;
     abctime clk = Abc_Clock();
@@ -1413,8 +1426,18 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( Pdr_ManSolveParUse( pPars ) )
+        p = Pdr_ManSolvePar( pAig, pPars, &RetValue );
+    else
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        RetValue = Pdr_ManSolveInt( p );
+    }
+    if ( p->pAig != pAig )
+    {
+        pAig->pSeqModel = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+    }
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1433,7 +1456,10 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     else if ( RetValue == 1 )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
+    pAigCopy = p->pAig != pAig ? p->pAig : NULL;
     Pdr_ManStop( p );
+    if ( pAigCopy )
+        Aig_ManStop( pAigCopy );
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
     if ( pPars->vOutMap )
@@ -70,6 +70,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Txs_Man_t_  Txs_Man_t;
 typedef struct Txs3_Man_t_ Txs3_Man_t;
+typedef struct Pdr_Shr_t_  Pdr_Shr_t;
 
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 struct Pdr_Set_t_
@@ -117,6 +118,9 @@ struct Pdr_Man_t_
     Pdr_Obl_t * pQueue;    // proof obligations
     int *       pOrder;    // ordering of the lits
     Vec_Int_t * vActVars;  // the counter of activation variables
+    Vec_Int_t * vRecStarts;// the number of solver rebuilds by frame
+    Vec_Int_t * vRecClas;  // the number of clauses re-added by frame
+    Vec_Wrd_t * vRecTime;  // the time spent rebuilding solvers by frame
     int         iUseFrame; // the first used frame
     int         nAbsFlops; // the number of flops used
     Vec_Int_t * vAbsFlops; // flops currently used
@@ -140,6 +144,10 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // parallel solving
+    Pdr_Shr_t * pShare;    // clauses shared with other workers
+    int         iWorker;   // the number of this worker
+    int         iShared;   // the number of shared clauses seen
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -158,6 +166,8 @@ struct Pdr_Man_t_
     int         nQueLim;
     int         nXsimRuns;
     int         nXsimLits;
+    int         nShareTried;
+    int         nShareAdded;
     // runtime
     abctime     timeToStop;
     abctime     timeToStopOne;
@@ -202,6 +212,7 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -216,6 +227,13 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+extern void            Pdr_ManPrintRecycling( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern int             Pdr_ManSolveParUse( Pdr_Par_t * pPars );
+extern Pdr_Man_t *     Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue );
+extern void            Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManShareImport( Pdr_Man_t * p );
+extern int             Pdr_ManShareStop( Pdr_Man_t * p );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
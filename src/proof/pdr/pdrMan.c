@@ -257,6 +257,9 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->pQueue   = NULL;
     p->pOrder   = ABC_ALLOC( int, Aig_ManRegNum(pAig) );
     p->vActVars = Vec_IntAlloc( 256 );
+    p->vRecStarts = Vec_IntAlloc( 256 );
+    p->vRecClas = Vec_IntAlloc( 256 );
+    p->vRecTime = Vec_WrdAlloc( 256 );
     if ( !p->pPars->fMonoCnf )
         p->vVLits   = Vec_WecStart( 1+Abc_MaxInt(1, Aig_ManLevels(pAig)) );
     // internal use
@@ -304,6 +307,35 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prints the solver recycling statistics by frame.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManPrintRecycling( Pdr_Man_t * p )
+{
+    int k, nRecycles = 0;
+    for ( k = 0; k < Vec_IntSize(p->vRecStarts); k++ )
+        nRecycles += Vec_IntEntry(p->vRecStarts, k);
+    if ( nRecycles == 0 )
+        return;
+    Abc_Print( 1, "Solver recycling by frame:\n" );
+    for ( k = 0; k < Vec_IntSize(p->vRecStarts); k++ )
+    {
+        if ( Vec_IntEntry(p->vRecStarts, k) == 0 )
+            continue;
+        Abc_Print( 1, "Frame %3d :  Rebuilds =%5d.  Clauses re-added =%8d.  ", 
+            k, Vec_IntEntry(p->vRecStarts, k), Vec_IntEntry(p->vRecClas, k) );
+        Abc_Print( 1, "Time = %8.2f sec\n", 1.0*((double)Vec_WrdEntry(p->vRecTime, k))/((double)CLOCKS_PER_SEC) );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Frees manager.]
@@ -336,6 +368,7 @@ void Pdr_ManStop( Pdr_Man_t * p )
         ABC_PRTP( "CNF compute", p->tCnf,       p->tTotal );
         ABC_PRTP( "Refinement ", p->tAbs,       p->tTotal );
         ABC_PRTP( "TOTAL      ", p->tTotal,     p->tTotal );
+        Pdr_ManPrintRecycling( p );
         fflush( stdout );
     }
 //    Abc_Print( 1, "SS =%6d. SU =%6d. US =%6d. UU =%6d.\n", p->nCasesSS, p->nCasesSU, p->nCasesUS, p->nCasesUU );
@@ -348,6 +381,9 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Pdr_QueueStop( p );
     ABC_FREE( p->pOrder );
     Vec_IntFree( p->vActVars );
+    Vec_IntFree( p->vRecStarts );
+    Vec_IntFree( p->vRecClas );
+    Vec_WrdFree( p->vRecTime );
     // static CNF
     Cnf_DataFree( p->pCnf1 );
     Vec_IntFreeP( &p->vVar2Reg );
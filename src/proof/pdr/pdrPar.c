@@ -0,0 +1,353 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with shared clauses.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The workers are complete PDR engines, each with its own copy of the AIG,
+// its own solvers and its own proof obligations. They differ in the
+// generalization settings and in the random seed. A cube blocked by one
+// worker is published in the shared store together with its frame. Other
+// workers import it into their frames after checking that it is inductive
+// relative to their own previous frame, so that their frames remain valid
+// whatever the other workers do. The first worker to finish decides the
+// problem and stops the others.
+struct Pdr_Shr_t_
+{
+    Vec_Ptr_t *      vCubes;    // the published cubes
+    Vec_Int_t *      vInfo;     // the frame and the worker of each cube
+    volatile int     nCubes;    // the number of published cubes
+    volatile int     fStop;     // the workers should stop
+    int              iWinner;   // the worker that finished first
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;     // protects the above
+#endif
+};
+
+typedef struct Pdr_Wrk_t_ Pdr_Wrk_t;
+struct Pdr_Wrk_t_
+{
+    Pdr_Par_t        Pars;      // the parameters of this worker
+    Pdr_Man_t *      pMan;      // the manager of this worker
+    int              RetValue;  // the result of this worker
+};
+
+typedef struct Pdr_Run_t_ Pdr_Run_t;
+struct Pdr_Run_t_
+{
+    Pdr_Shr_t *      pShare;    // the shared store
+    Pdr_Wrk_t *      pWrks;     // the workers
+};
+
+static inline void Pdr_ShrLock( Pdr_Shr_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Pdr_ShrUnlock( Pdr_Shr_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the parallel mode applies to these parameters.]
+
+  Description [Solving all outputs, per-output timeouts, abstraction
+  and the bridge mode are supported by the single-threaded engine only.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveParUse( Pdr_Par_t * pPars )
+{
+    return pPars->nThreads > 1 && Util_PthEnabled() && !pPars->fSolveAll &&
+        !pPars->nTimeOutOne && !pPars->fUseAbs && !pPars->fUseBridge;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes a cube blocked by this worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSharePublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    Pdr_ShrLock( pShare );
+    Vec_PtrPush( pShare->vCubes, Pdr_SetDup(pCube) );
+    Vec_IntPushTwo( pShare->vInfo, k, p->iWorker );
+    pShare->nCubes++;
+    Pdr_ShrUnlock( pShare );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the worker should stop.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareStop( Pdr_Man_t * p )
+{
+    return p->pShare->fStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Imports the cubes published by other workers.]
+
+  Description [A cube blocked in frame k by another worker is added to
+  frame k of this worker (or to the last frame, if k is larger), if it
+  does not contain an initial state, is not subsumed by the clauses
+  already there, and is inductive relative to the previous frame.
+  Returns -1 if the resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShare = p->pShare;
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vFrames;
+    Pdr_Set_t * pCube;
+    int i, k, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( p->iShared == pShare->nCubes || kMax < 1 )
+        return 0;
+    // collect the new cubes of other workers
+    vCubes  = Vec_PtrAlloc( 16 );
+    vFrames = Vec_IntAlloc( 16 );
+    Pdr_ShrLock( pShare );
+    for ( i = p->iShared; i < Vec_PtrSize(pShare->vCubes); i++ )
+    {
+        if ( Vec_IntEntry(pShare->vInfo, 2*i+1) == p->iWorker )
+            continue;
+        Vec_PtrPush( vCubes, Pdr_SetDup((Pdr_Set_t *)Vec_PtrEntry(pShare->vCubes, i)) );
+        Vec_IntPush( vFrames, Vec_IntEntry(pShare->vInfo, 2*i) );
+    }
+    p->iShared = Vec_PtrSize(pShare->vCubes);
+    Pdr_ShrUnlock( pShare );
+    // add those that hold in this worker
+    RetValue = 0;
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        k = Abc_MinInt( Vec_IntEntry(vFrames, i), kMax );
+        if ( RetValue == -1 || Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        p->nShareTried++;
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, 0, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        p->nShareAdded++;
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( ; k >= 1; k-- )
+            Pdr_ManSolverAddClause( p, k, pCube );
+    }
+    Vec_PtrFree( vCubes );
+    Vec_IntFree( vFrames );
+    return RetValue == -1 ? -1 : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ManSolveParTask( void * pUser, int iTask, int iThread )
+{
+    Pdr_Run_t * pRun = (Pdr_Run_t *)pUser;
+    Pdr_Shr_t * pShare = pRun->pShare;
+    Pdr_Wrk_t * pWrk = pRun->pWrks + iTask;
+    pWrk->RetValue = Pdr_ManSolveInt( pWrk->pMan );
+    Pdr_ShrLock( pShare );
+    if ( pWrk->RetValue != -1 && pShare->iWinner == -1 )
+        pShare->iWinner = iTask;
+    pShare->fStop = 1;
+    Pdr_ShrUnlock( pShare );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using several workers.]
+
+  Description [Returns the manager of the worker that decided the
+  problem (or of the first worker, if none did), with its result in
+  pRetValue. The AIG of the returned manager is a copy of the original
+  AIG, unless it is the first worker.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_Shr_t Share, * pShare = &Share;
+    Pdr_Run_t Run, * pRun = &Run;
+    Pdr_Wrk_t * pWrk;
+    Pdr_Set_t * pCube;
+    Pdr_Man_t * p;
+    int i, iBest, nWorkers = Abc_MinInt( pPars->nThreads, UTIL_PTH_MAX );
+    abctime clk = Abc_Clock();
+    memset( pShare, 0, sizeof(Pdr_Shr_t) );
+    pShare->vCubes  = Vec_PtrAlloc( 1000 );
+    pShare->vInfo   = Vec_IntAlloc( 2000 );
+    pShare->iWinner = -1;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pShare->Mutex, NULL );
+#endif
+    // the first worker uses the given parameters; others vary generalization
+    pRun->pShare = pShare;
+    pRun->pWrks  = ABC_CALLOC( Pdr_Wrk_t, nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        pWrk = pRun->pWrks + i;
+        pWrk->Pars = *pPars;
+        if ( i > 0 )
+        {
+            pWrk->Pars.nRandomSeed += i;
+            pWrk->Pars.fTwoRounds  ^= (i & 1);
+            pWrk->Pars.fFlopOrder  ^= ((i >> 1) & 1);
+            pWrk->Pars.fVerbose     = 0;
+            pWrk->Pars.fVeryVerbose = 0;
+            pWrk->Pars.fNotVerbose  = 1;
+            pWrk->Pars.fSilent      = 1;
+            pWrk->Pars.fDumpInv     = 0;
+        }
+        pWrk->pMan = Pdr_ManStart( i ? Aig_ManDupSimple(pAig) : pAig, &pWrk->Pars, NULL );
+        pWrk->pMan->pShare  = pShare;
+        pWrk->pMan->iWorker = i;
+    }
+    Util_PthRun( nWorkers, nWorkers, Pdr_ManSolveParTask, pRun );
+    iBest = pShare->iWinner == -1 ? 0 : pShare->iWinner;
+    if ( pPars->fVerbose )
+    {
+        printf( "Parallel PDR with %d workers: ", nWorkers );
+        if ( pShare->iWinner == -1 )
+            printf( "undecided.  " );
+        else
+            printf( "worker %d finished first.  ", pShare->iWinner );
+        printf( "Published clauses = %d.  ", Vec_PtrSize(pShare->vCubes) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        for ( i = 0; i < nWorkers; i++ )
+        {
+            p = pRun->pWrks[i].pMan;
+            printf( "Worker %2d : Frame = %4d  Clauses = %7d  Imported = %7d (out of %7d)  Result = %2d\n",
+                i, p->nFrames, p->nCubes, p->nShareAdded, p->nShareTried, pRun->pWrks[i].RetValue );
+        }
+    }
+    // keep the manager of the best worker
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        p = pRun->pWrks[i].pMan;
+        p->pShare = NULL;
+        if ( i == iBest )
+            continue;
+        pRun->pWrks[i].Pars.fVerbose = 0;
+        if ( i > 0 )
+        {
+            Aig_Man_t * pAigCopy = p->pAig;
+            Pdr_ManStop( p );
+            Aig_ManStop( pAigCopy );
+        }
+        else
+            Pdr_ManStop( p );
+    }
+    p = pRun->pWrks[iBest].pMan;
+    *pRetValue = pRun->pWrks[iBest].RetValue;
+    // report the results using the original parameters
+    pPars->iFrame         = p->pPars->iFrame;
+    pPars->nProveOuts     = p->pPars->nProveOuts;
+    pPars->nFailOuts      = p->pPars->nFailOuts;
+    pPars->timeLastSolved = p->pPars->timeLastSolved;
+    p->pPars = pPars;
+    if ( iBest > 0 && *pRetValue == 1 && !pPars->fSilent )
+    {
+        Pdr_ManReportInvariant( p );
+        Pdr_ManVerifyInvariant( p );
+    }
+    ABC_FREE( pRun->pWrks );
+    // free the shared store
+    Vec_PtrForEachEntry( Pdr_Set_t *, pShare->vCubes, pCube, i )
+        Pdr_SetDeref( pCube );
+    Vec_PtrFree( pShare->vCubes );
+    Vec_IntFree( pShare->vInfo );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &pShare->Mutex );
+#endif
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -57,6 +57,9 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
     Vec_PtrPush( p->vSolvers, pSat );
     Vec_VecExpand( p->vClauses, k );
     Vec_IntPush( p->vActVars, 0 );
+    Vec_IntPush( p->vRecStarts, 0 );
+    Vec_IntPush( p->vRecClas, 0 );
+    Vec_WrdPush( p->vRecTime, 0 );
     // add property cone
     Saig_ManForEachPo( p->pAig, pObj, i )
         Pdr_ObjSatVar( p, k, 1, pObj );
@@ -67,7 +70,8 @@ sat_solver * Pdr_ManCreateSolver( Pdr_Man_t * p, int k )
 
   Synopsis    [Returns old or restarted solver.]
 
-  Description []
+  Description [The solver is rebuilt after nRecycle activation 
+  literals are used. The rebuilds are recorded for each frame.]
                
   SideEffects []
 
@@ -80,11 +84,13 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     Vec_Ptr_t * vArrayK;
     Pdr_Set_t * pCube;
     int i, j;
+    abctime clk;
     pSat = Pdr_ManSolver(p, k);
     if ( Vec_IntEntry(p->vActVars, k) < p->pPars->nRecycle )
         return pSat;
     assert( k < Vec_PtrSize(p->vSolvers) - 1 );
     p->nStarts++;
+    clk = Abc_Clock();
 //    sat_solver_delete( pSat );
 //    pSat = sat_solver_new();
 //    sat_solver_restart( pSat );
@@ -99,7 +105,12 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     // add the clauses
     Vec_VecForEachLevelStart( p->vClauses, vArrayK, i, k )
         Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, j )
+        {
             Pdr_ManSolverAddClause( p, k, pCube );
+            Vec_IntAddToEntry( p->vRecClas, k, 1 );
+        }
+    Vec_IntAddToEntry( p->vRecStarts, k, 1 );
+    Vec_WrdAddToEntry( p->vRecTime, k, (word)(Abc_Clock() - clk) );
     return pSat;
 }
 
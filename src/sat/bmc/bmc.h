@@ -131,6 +131,8 @@ struct Saig_ParBmc_t_
 };
 
  
+typedef struct Bmc_IncMan_t_ Bmc_IncMan_t;
+
 typedef struct Bmc_AndPar_t_ Bmc_AndPar_t;
 struct Bmc_AndPar_t_
 {
@@ -141,6 +143,7 @@ struct Bmc_AndPar_t_
     int         nTimeOut;       // timeout in seconds
     int         nLutSize;       // LUT size for cut computation
     int         nProcs;         // the number of parallel solvers
+    int         nShareLbd;      // the largest LBD of learned clauses shared by parallel solvers
     int         fLoadCnf;       // dynamic CNF loading
     int         fDumpFrames;    // dump unrolled timeframes
     int         fUseSynth;      // use synthesis
@@ -155,6 +158,8 @@ struct Bmc_AndPar_t_
     int         nDropOuts;      // the number of dropped outputs
     
     void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
+    int         RunId;          // BMC id in this run 
+    int(*pFuncStop)(int);       // callback to terminate
 };
   
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
@@ -223,6 +228,11 @@ extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
+/*=== bmcBmcInc.c ==========================================================*/
+extern Bmc_IncMan_t *    Bmc_IncManStart();
+extern void              Bmc_IncManStop( Bmc_IncMan_t * p );
+extern void              Bmc_IncManPrint( Bmc_IncMan_t * p );
+extern int               Bmc_IncManPerform( Bmc_IncMan_t * p, Gia_Man_t * pGia, Bmc_AndPar_t * pPars );
 /*=== bmcCexCare.c ==========================================================*/
 extern Abc_Cex_t *       Bmc_CexCareExtendToObjects( Gia_Man_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCexCare );
 extern Abc_Cex_t *       Bmc_CexCareMinimize( Aig_Man_t * p, int nRealPis, Abc_Cex_t * pCex, int nTryCexes, int fCheck, int fVerbose );
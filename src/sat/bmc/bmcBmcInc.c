@@ -0,0 +1,460 @@
+/**CFile****************************************************************
+
+  FileName    [bmcBmcInc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [BMC session reusing the unrolling and the CNF across designs.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: bmcBmcInc.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "misc/util/utilNam.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The session keeps one structurally hashed unrolling shared by all
+// designs checked in it. The primary inputs of the timeframes are matched
+// by name (or by index if the design has no names), and the registers are
+// zero in the first frame. Thus, the logic of a new design, which is
+// structurally identical in the unrolling to the logic of an earlier one,
+// is hashed to the same nodes, which already have SAT variables and
+// clauses. Only the new nodes are added to the solver. Because the solver
+// only receives the clauses defining the nodes and the units asserting
+// the outputs proved unreachable, its learned clauses remain valid for
+// every design and are kept.
+struct Bmc_IncMan_t_
+{
+    Gia_Man_t *       pFrames;      // the unrolling of all designs
+    Abc_Nam_t *       pNames;       // the names of the primary inputs
+    Vec_Wec_t *       vName2Fr;     // for each name, the CI of pFrames in each frame
+    Vec_Int_t *       vCiMap;       // for each CI of pFrames, the name and the frame
+    Vec_Int_t *       vFr2Sat;      // for each object of pFrames, the SAT variable
+    Vec_Int_t *       vProved;      // for each literal of pFrames, 1 if proved to be 0
+    Vec_Int_t *       vNodes;       // the nodes of pFrames to be added to the solver
+    Vec_Int_t *       vStack;       // the stack used to collect them
+    sat_solver *      pSat;         // the SAT solver
+    int               nSatVars;     // the number of SAT variables
+    int               nDesigns;     // the number of designs checked
+    // the current design
+    Gia_Man_t *       pGia;         // the design
+    Vec_Int_t *       vPiNames;     // the names of its primary inputs
+    Vec_Ptr_t *       vGia2Fr;      // its copies in each timeframe
+    // statistics of the current design
+    int               nAnds;        // the AND nodes of the unrolling used
+    int               nAndsNew;     // the AND nodes added to the unrolling
+    int               nVarsNew;     // the SAT variables added
+    int               nClausesNew;  // the clauses added
+    int               nProvedOld;   // the outputs proved for an earlier design
+};
+
+static inline int * Bmc_IncManCopies( Bmc_IncMan_t * p, int f ) { return (int *)Vec_PtrEntry(p->vGia2Fr, f); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the session.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_IncMan_t * Bmc_IncManStart()
+{
+    Bmc_IncMan_t * p = ABC_CALLOC( Bmc_IncMan_t, 1 );
+    p->pFrames  = Gia_ManStart( 10000 );
+    p->pFrames->pName = Abc_UtilStrsav( "bmc_session" );
+    Gia_ManHashStart( p->pFrames );
+    p->pNames   = Abc_NamStart( 1000, 20 );
+    p->vName2Fr = Vec_WecStart( 1 );
+    p->vCiMap   = Vec_IntAlloc( 1000 );
+    p->vFr2Sat  = Vec_IntAlloc( 10000 );
+    p->vProved  = Vec_IntAlloc( 20000 );
+    p->vNodes   = Vec_IntAlloc( 1000 );
+    p->vStack   = Vec_IntAlloc( 1000 );
+    p->pSat     = sat_solver_new();
+    // the constant node gets a variable, which is always 0
+    sat_solver_setnvars( p->pSat, 1000 );
+    sat_solver_add_const( p->pSat, 0, 1 );
+    Vec_IntPush( p->vFr2Sat, 0 );
+    p->nSatVars = 1;
+    return p;
+}
+void Bmc_IncManStop( Bmc_IncMan_t * p )
+{
+    if ( p == NULL )
+        return;
+    Gia_ManStop( p->pFrames );
+    Abc_NamStop( p->pNames );
+    Vec_WecFree( p->vName2Fr );
+    Vec_IntFree( p->vCiMap );
+    Vec_IntFree( p->vFr2Sat );
+    Vec_IntFree( p->vProved );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vStack );
+    sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the size of the session.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_IncManPrint( Bmc_IncMan_t * p )
+{
+    printf( "BMC session: Designs = %d.  Frames: PI = %d.  AND = %d.  ",
+        p->nDesigns, Gia_ManPiNum(p->pFrames), Gia_ManAndNum(p->pFrames) );
+    printf( "SAT: Var = %d.  Cla = %d.  Learn = %d.  Conf = %d.  ",
+        p->nSatVars, sat_solver_nclauses(p->pSat), (int)p->pSat->stats.learnts, sat_solver_nconflicts(p->pSat) );
+    printf( "Mem = %.2f MB.\n", 1.0*(Gia_ManMemory(p->pFrames) + sat_solver_memory(p->pSat) +
+        4*(Vec_IntCap(p->vFr2Sat) + Vec_IntCap(p->vProved) + Vec_IntCap(p->vCiMap)))/(1<<20) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Unrolls the current design into the shared timeframes.]
+
+  Description [Derives the literals of pFrames for the objects of the
+  design in frame f, which are in the sequential cone of the outputs
+  (marked by Gia_ManSeqMarkUsed). The objects are visited in the
+  topological order and the registers take the values of the previous
+  frame, so the unrolling does not recurse across the frames. The PIs
+  of the frame are added to pFrames when they are used for the first time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_IncManFramePi( Bmc_IncMan_t * p, int iName, int f )
+{
+    Vec_Int_t * vFrames;
+    while ( Vec_WecSize(p->vName2Fr) <= iName )
+        Vec_WecPushLevel( p->vName2Fr );
+    vFrames = Vec_WecEntry( p->vName2Fr, iName );
+    Vec_IntFillExtra( vFrames, f+1, 0 );
+    if ( Vec_IntEntry(vFrames, f) == 0 )
+    {
+        Vec_IntWriteEntry( vFrames, f, Abc_Lit2Var(Gia_ManAppendCi(p->pFrames)) );
+        Vec_IntPushTwo( p->vCiMap, iName, f );
+    }
+    return Abc_Var2Lit( Vec_IntEntry(vFrames, f), 0 );
+}
+static inline int Bmc_IncManFanin( Bmc_IncMan_t * p, int * pCopies, int iFan, int fCompl, int f )
+{
+    if ( pCopies[iFan] == -1 )
+    {
+        Gia_Obj_t * pFan = Gia_ManObj( p->pGia, iFan );
+        assert( Gia_ObjIsPi(p->pGia, pFan) );
+        pCopies[iFan] = Bmc_IncManFramePi( p, Vec_IntEntry(p->vPiNames, Gia_ObjCioId(pFan)), f );
+    }
+    return Abc_LitNotCond( pCopies[iFan], fCompl );
+}
+static void Bmc_IncManUnfoldFrame( Bmc_IncMan_t * p, int f )
+{
+    Gia_Obj_t * pObj;
+    int i, iLit, iNew, nObjs, * pCopies, * pCopiesPrev = f ? Bmc_IncManCopies( p, f-1 ) : NULL;
+    Vec_PtrPush( p->vGia2Fr, ABC_FALLOC(int, Gia_ManObjNum(p->pGia)) );
+    pCopies = Bmc_IncManCopies( p, f );
+    pCopies[0] = 0;
+    Gia_ManForEachObj1( p->pGia, pObj, i )
+    {
+        if ( pObj->fMark0 || Gia_ObjIsPi(p->pGia, pObj) )
+            continue;
+        if ( Gia_ObjIsRo(p->pGia, pObj) )
+            pCopies[i] = f ? pCopiesPrev[Gia_ObjId(p->pGia, Gia_ObjRoToRi(p->pGia, pObj))] : 0;
+        else if ( Gia_ObjIsCo(pObj) )
+            pCopies[i] = Bmc_IncManFanin( p, pCopies, Gia_ObjFaninId0(pObj, i), Gia_ObjFaninC0(pObj), f );
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            iLit = Bmc_IncManFanin( p, pCopies, Gia_ObjFaninId0(pObj, i), Gia_ObjFaninC0(pObj), f );
+            if ( iLit > 0 )
+            {
+                iNew  = Bmc_IncManFanin( p, pCopies, Gia_ObjFaninId1(pObj, i), Gia_ObjFaninC1(pObj), f );
+                nObjs = Gia_ManObjNum( p->pFrames );
+                iLit  = Gia_ManHashAnd( p->pFrames, iLit, iNew );
+                p->nAndsNew += Gia_ManObjNum(p->pFrames) - nObjs;
+                p->nAnds += Gia_ObjIsAnd( Gia_ManObj(p->pFrames, Abc_Lit2Var(iLit)) );
+            }
+            pCopies[i] = iLit;
+        }
+        else assert( 0 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of the nodes without SAT variables.]
+
+  Description [Returns the SAT variable of the object of pFrames. The
+  cone of the object is collected using an explicit stack, because it
+  may span many timeframes, and the nodes are added in the topological
+  order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmc_IncManCnf( Bmc_IncMan_t * p, int iRoot )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iObj, iFan, iVar;
+    Vec_IntFillExtra( p->vFr2Sat, Gia_ManObjNum(p->pFrames), -1 );
+    if ( (iVar = Vec_IntEntry(p->vFr2Sat, iRoot)) >= 0 )
+        return iVar;
+    // collect the nodes without SAT variables (they are labeled by -2)
+    Vec_IntClear( p->vNodes );
+    Vec_IntFill( p->vStack, 1, iRoot );
+    Vec_IntWriteEntry( p->vFr2Sat, iRoot, -2 );
+    while ( Vec_IntSize(p->vStack) > 0 )
+    {
+        iObj = Vec_IntPop( p->vStack );
+        Vec_IntPush( p->vNodes, iObj );
+        pObj = Gia_ManObj( p->pFrames, iObj );
+        if ( !Gia_ObjIsAnd(pObj) )
+        {
+            assert( Gia_ObjIsCi(pObj) );
+            continue;
+        }
+        for ( k = 0; k < 2; k++ )
+        {
+            iFan = k ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+            if ( Vec_IntEntry(p->vFr2Sat, iFan) != -1 )
+                continue;
+            Vec_IntWriteEntry( p->vFr2Sat, iFan, -2 );
+            Vec_IntPush( p->vStack, iFan );
+        }
+    }
+    // add the nodes in the topological order
+    Vec_IntSort( p->vNodes, 0 );
+    Vec_IntForEachEntry( p->vNodes, iObj, i )
+    {
+        pObj = Gia_ManObj( p->pFrames, iObj );
+        iVar = p->nSatVars++;
+        if ( p->nSatVars > sat_solver_nvars(p->pSat) )
+            sat_solver_setnvars( p->pSat, 2 * p->nSatVars );
+        if ( Gia_ObjIsAnd(pObj) )
+            p->nClausesNew += sat_solver_add_and( p->pSat, iVar,
+                Vec_IntEntry(p->vFr2Sat, Gia_ObjFaninId0(pObj, iObj)), Vec_IntEntry(p->vFr2Sat, Gia_ObjFaninId1(pObj, iObj)),
+                Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+        Vec_IntWriteEntry( p->vFr2Sat, iObj, iVar );
+        p->nVarsNew++;
+    }
+    return Vec_IntEntry( p->vFr2Sat, iRoot );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example for the current design.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Bmc_IncManGenerateCex( Bmc_IncMan_t * p, int i, int f, int fSat )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(pGia), Gia_ManPiNum(pGia), Gia_ManPoNum(pGia), f*Gia_ManPoNum(pGia)+i );
+    Vec_Int_t * vFrames;
+    int k, fr, iObj, iVar;
+    if ( !fSat ) // the output is constant 1
+        return pCex;
+    for ( k = 0; k < Gia_ManPiNum(pGia); k++ )
+    {
+        vFrames = Vec_WecEntry( p->vName2Fr, Vec_IntEntry(p->vPiNames, k) );
+        for ( fr = 0; fr <= f && fr < Vec_IntSize(vFrames); fr++ )
+        {
+            if ( (iObj = Vec_IntEntry(vFrames, fr)) == 0 || iObj >= Vec_IntSize(p->vFr2Sat) )
+                continue;
+            iVar = Vec_IntEntry( p->vFr2Sat, iObj );
+            if ( iVar > 0 && sat_solver_var_value(p->pSat, iVar) )
+                Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(pGia) + fr * Gia_ManPiNum(pGia) + k );
+        }
+    }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the current design.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc_IncManDesignStart( Bmc_IncMan_t * p, Gia_Man_t * pGia )
+{
+    char Buffer[100];
+    int k;
+    p->pGia     = pGia;
+    p->vPiNames = Vec_IntAlloc( Gia_ManPiNum(pGia) );
+    p->vGia2Fr  = Vec_PtrAlloc( 100 );
+    for ( k = 0; k < Gia_ManPiNum(pGia); k++ )
+    {
+        char * pName = Gia_ObjCiName( pGia, k );
+        if ( pName == NULL )
+            sprintf( (pName = Buffer), "pi%d", k );
+        Vec_IntPush( p->vPiNames, Abc_NamStrFindOrAdd(p->pNames, pName, NULL) );
+    }
+    p->nAnds = p->nAndsNew = p->nVarsNew = p->nClausesNew = p->nProvedOld = 0;
+    p->nDesigns++;
+    Gia_ManSeqMarkUsed( pGia );
+}
+static void Bmc_IncManDesignStop( Bmc_IncMan_t * p )
+{
+    Vec_PtrFreeFree( p->vGia2Fr );
+    Vec_IntFree( p->vPiNames );
+    Gia_ManCleanMark0( p->pGia );
+    p->vGia2Fr  = NULL;
+    p->vPiNames = NULL;
+    p->pGia     = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs BMC of the design in the session.]
+
+  Description [Returns 0 if an output is asserted (the counter-example
+  is in pGia->pCexSeq), and -1 if the frame limit, the conflict limit
+  or the timeout is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_IncManPerform( Bmc_IncMan_t * p, Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    abctime clkStart = Abc_Clock(), clkSat = 0, clk;
+    int nConfStart = sat_solver_nconflicts( p->pSat );
+    int i, f, iLit, iVar, Lit = 0, * pCopies, status, RetValue = -1, fStop = 0, iOut = -1, fOut = -1;
+    Gia_Obj_t * pObj;
+    assert( Gia_ManRegNum(pGia) > 0 );
+    Abc_CexFreeP( &pGia->pCexSeq );
+    Bmc_IncManDesignStart( p, pGia );
+    if ( pPars->nTimeOut )
+        sat_solver_set_runtime_limit( p->pSat, pPars->nTimeOut * CLOCKS_PER_SEC + clkStart );
+    for ( f = 0; !fStop && (!pPars->nFramesMax || f < pPars->nFramesMax); f++ )
+    {
+        Bmc_IncManUnfoldFrame( p, f );
+        pCopies = Bmc_IncManCopies( p, f );
+        Vec_IntFillExtra( p->vProved, 2*Gia_ManObjNum(p->pFrames), 0 );
+        Gia_ManForEachPo( pGia, pObj, i )
+        {
+            iLit = pCopies[Gia_ObjId(pGia, pObj)];
+            if ( iLit == 0 )
+                continue;
+            if ( Vec_IntEntry(p->vProved, iLit) )
+            {
+                p->nProvedOld++;
+                continue;
+            }
+            if ( iLit == 1 )
+                status = l_True;
+            else
+            {
+                if ( pPars->nTimeOut && Abc_Clock() > pPars->nTimeOut * CLOCKS_PER_SEC + clkStart )
+                {
+                    fStop = 1;
+                    break;
+                }
+                iVar = Bmc_IncManCnf( p, Abc_Lit2Var(iLit) );
+                Lit  = Abc_Var2Lit( iVar, Abc_LitIsCompl(iLit) );
+                clk  = Abc_Clock();
+                status = sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)pPars->nConfLimit, 0, 0, 0 );
+                clkSat += Abc_Clock() - clk;
+            }
+            if ( status == l_False )
+            {
+                Lit = Abc_LitNot( Lit );
+                sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+                Vec_IntWriteEntry( p->vProved, iLit, 1 );
+                continue;
+            }
+            if ( status == l_True )
+            {
+                RetValue = 0;
+                pPars->nFailOuts++;
+                pGia->pCexSeq = Bmc_IncManGenerateCex( p, i, f, iLit != 1 );
+            }
+            iOut = i;
+            fOut = f;
+            fStop = 1;
+            break;
+        }
+        pPars->iFrame = f - fStop;
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "%4d %s : ", f, fStop ? "-" : "+" );
+            Abc_Print( 1, "AND =%9d (new =%9d).  ", p->nAnds, p->nAndsNew );
+            Abc_Print( 1, "Var =%9d.  Cla =%10d.  Conf =%8d.  ", p->nSatVars, sat_solver_nclauses(p->pSat), sat_solver_nconflicts(p->pSat) - nConfStart );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+        }
+    }
+    // the per-frame statistics are printed first, the result is printed with the time
+    if ( !pPars->fNotVerbose )
+    {
+        if ( RetValue == 0 )
+            Abc_Print( 1, "Output %*d was asserted in frame %2d.  ", Abc_Base10Log(Gia_ManPoNum(pGia)), iOut, fOut );
+        else if ( iOut >= 0 )
+            Abc_Print( 1, "Output %d in frame %d is undecided.  ", iOut, fOut );
+        else if ( !fStop )
+            Abc_Print( 1, "No output failed in %d frames.  ", f );
+    }
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( pPars->fVerbose || p->nDesigns > 1 )
+    {
+        Abc_Print( 1, "Design %d: Frames = %d.  AND = %d (reused %.2f %%).  ",
+            p->nDesigns, f, p->nAnds, 100.0 * (p->nAnds - p->nAndsNew) / Abc_MaxInt(1, p->nAnds) );
+        Abc_Print( 1, "New var = %d.  New cla = %d.  Outputs proved earlier = %d.  ",
+            p->nVarsNew, p->nClausesNew, p->nProvedOld );
+        Abc_PrintTime( 1, "SAT", clkSat );
+    }
+    if ( pPars->nTimeOut )
+        sat_solver_set_runtime_limit( p->pSat, 0 );
+    Bmc_IncManDesignStop( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -21,6 +21,7 @@
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
 #include "sat/satoko/satoko.h"
+#include "misc/util/utilPth.h"
 
 
 //#define ABC_USE_EXT_SOLVERS 1
@@ -397,6 +398,10 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         bmc_sat_solver_addvar( p->pSats[i] );
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmc_sat_solver_setstop( p->pSats[i], &p->fStopNow );
+#ifndef ABC_USE_EXT_SOLVERS
+        satoko_set_runid( p->pSats[i], pPars->RunId );
+        satoko_set_stop_func( p->pSats[i], pPars->pFuncStop );
+#endif
     }
     p->nSatVars = 1;
     return p;
@@ -642,7 +647,13 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Abc_CexFreeP( &pGia->pCexSeq );
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
     {
-        Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
+        Cnf_Dat_t * pCnf;
+        // the frames without new logic do not reach the checks below
+        if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+            break;
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            break;
+        pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
         if ( pCnf == NULL )
         {
             Bmcs_ManPrintFrame( p, f, nClauses, -1, clkStart );
@@ -666,6 +677,8 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
+                if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+                    break;
                 status = bmc_sat_solver_solve( p->pSats[0], &iLit, 1 );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
@@ -704,7 +717,8 @@ int Bmcs_ManPerformOne( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( !pPars->fNotVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
     Bmcs_ManStop( p );
     return RetValue;
@@ -730,14 +744,28 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) { return Bmcs
 #else // pthreads are used
 
 
-typedef struct Par_ThData_t_
+#define PAR_SHARE_SIZE (1 << 16)            // the number of ints in the ring of one thread
+#define PAR_SHARE_MASK (PAR_SHARE_SIZE - 1)
+#define PAR_SHARE_LITS 64                   // the largest number of literals in a shared clause
+
+typedef struct Par_ThData_t_ Par_ThData_t;
+struct Par_ThData_t_
 {
     bmc_sat_solver *  pSat;
     int         iLit;
     int         iThread;
     int         fWorking;
     int         status;
-} Par_ThData_t;
+    // clause sharing
+    Par_ThData_t *    pAll;                 // the data of all threads
+    int         nThreads;                   // the number of threads
+    int *       pRing;                      // exported clauses (size, LBD, literals)
+    volatile word iHead;                    // the number of ints ever written into the ring
+    word *      pTails;                     // the number of ints read from the ring of each thread
+    int         pBuffer[PAR_SHARE_LITS];    // the clause being imported
+    word        nShared;                    // the number of clauses written into the ring
+    word        nDropped;                   // the number of ints overwritten before being read
+};
 
 void * Bmcs_ManWorkerThread( void * pArg )
 {
@@ -764,6 +792,98 @@ void * Bmcs_ManWorkerThread( void * pArg )
     return NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Shares learned clauses among the concurrent solvers.]
+
+  Description [Each thread writes its short learned clauses with small LBD
+  into its own ring buffer, without locking, and publishes them by moving
+  the head after a memory barrier. The other threads read the rings at the
+  restarts. If the writer gets ahead by more than the size of the ring,
+  the unread clauses are dropped; a clause is accepted only if the writer
+  could not have started overwriting it before it was copied. Since all 
+  solvers are given the same clauses before each problem is solved, the
+  clauses learned by one of them are implied by the clauses of others.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcs_ManExportClause( void * pUser, int * pLits, int nLits, int Lbd )
+{
+    Par_ThData_t * pThData = (Par_ThData_t *)pUser;
+    word iHead = pThData->iHead;
+    int k;
+    if ( nLits > PAR_SHARE_LITS )
+        return;
+    pThData->pRing[iHead++ & PAR_SHARE_MASK] = nLits;
+    pThData->pRing[iHead++ & PAR_SHARE_MASK] = Lbd;
+    for ( k = 0; k < nLits; k++ )
+        pThData->pRing[iHead++ & PAR_SHARE_MASK] = pLits[k];
+    Util_PthMemoryBarrier();
+    pThData->iHead = iHead;
+    pThData->nShared++;
+}
+int Bmcs_ManImportClauses( void * pUser, satoko_t * pSat )
+{
+    Par_ThData_t * pThData = (Par_ThData_t *)pUser;
+    int i, k, nLits, Lbd;
+    for ( i = 0; i < pThData->nThreads; i++ )
+    {
+        Par_ThData_t * pOther = pThData->pAll + i;
+        word iTail = pThData->pTails[i], iHead = pOther->iHead;
+        if ( i == pThData->iThread || iTail == iHead )
+            continue;
+        Util_PthMemoryBarrier();
+        if ( iHead - iTail > PAR_SHARE_SIZE - PAR_SHARE_LITS - 2 )
+        {
+            pThData->nDropped += iHead - iTail;
+            pThData->pTails[i] = iHead;
+            continue;
+        }
+        while ( iTail < iHead )
+        {
+            nLits = pOther->pRing[iTail & PAR_SHARE_MASK];
+            Lbd   = pOther->pRing[(iTail + 1) & PAR_SHARE_MASK];
+            nLits = Abc_MinInt( Abc_MaxInt(nLits, 0), PAR_SHARE_LITS ); // garbage if overwritten
+            for ( k = 0; k < nLits; k++ )
+                pThData->pBuffer[k] = pOther->pRing[(iTail + 2 + k) & PAR_SHARE_MASK];
+            Util_PthMemoryBarrier();
+            if ( pOther->iHead + PAR_SHARE_LITS + 2 - iTail > PAR_SHARE_SIZE )
+            {
+                pThData->nDropped += pOther->iHead - iTail;
+                iTail = pOther->iHead;
+                break;
+            }
+            assert( nLits > 0 );
+            iTail += nLits + 2;
+            if ( satoko_import_clause( pSat, pThData->pBuffer, nLits, Lbd ) == SATOKO_ERR )
+            {
+                pThData->pTails[i] = iTail;
+                return SATOKO_ERR;
+            }
+        }
+        pThData->pTails[i] = iTail;
+    }
+    return SATOKO_OK;
+}
+void Bmcs_ManPrintShare( Bmcs_Man_t * p, Par_ThData_t * ThData )
+{
+    int i;
+    if ( !p->pPars->fVerbose || !p->pPars->nShareLbd )
+        return;
+    for ( i = 0; i < p->pPars->nProcs; i++ )
+    {
+        satoko_stats_t * pStats = satoko_stats( p->pSats[i] );
+        Abc_Print( 1, "Solver %d : ", i );
+        Abc_Print( 1, "Shared =%9.0f.  ",   (double)ThData[i].nShared );
+        Abc_Print( 1, "Imported =%9.0f.  ", (double)pStats->n_imported );
+        Abc_Print( 1, "Useful =%9.0f (%6.2f %%).  ", (double)pStats->n_imported_useful, 100.0 * pStats->n_imported_useful / Abc_MaxInt(1, pStats->n_imported) );
+        Abc_Print( 1, "Dropped =%9.0f.\n", (double)ThData[i].nDropped );
+    }
+}
+
 int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, Par_ThData_t * ThData, int nProcs, int * pSolver )
 {
     int i, status = -1;
@@ -825,12 +945,29 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         ThData[i].iThread  =  i;
         ThData[i].fWorking =  0;
         ThData[i].status   = -1;
+        ThData[i].pAll     = ThData;
+        ThData[i].nThreads = pPars->nProcs;
+        ThData[i].pRing    = pPars->nShareLbd ? ABC_ALLOC( int, PAR_SHARE_SIZE ) : NULL;
+        ThData[i].iHead    =  0;
+        ThData[i].pTails   = ABC_CALLOC( word, pPars->nProcs );
+        ThData[i].nShared  =  0;
+        ThData[i].nDropped =  0;
+#ifndef ABC_USE_EXT_SOLVERS
+        if ( pPars->nShareLbd )
+            satoko_set_share( p->pSats[i], ThData + i, Bmcs_ManExportClause, Bmcs_ManImportClauses, pPars->nShareLbd );
+#endif
         status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
     {
-        Cnf_Dat_t * pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
+        Cnf_Dat_t * pCnf;
+        // the frames without new logic do not reach the checks below
+        if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
+            break;
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            break;
+        pCnf = Bmcs_ManAddNewCnf( p, f, pPars->nFramesAdd );
         if ( pCnf == NULL )
         {
             Bmcs_ManPrintFrame( p, f, nClauses, 0, clkStart );
@@ -857,6 +994,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
+                if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+                    break;
                 status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
@@ -902,8 +1041,15 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
+    if ( !pPars->fNotVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkStart );
     Bmcs_ManPrintTime( p );
+    Bmcs_ManPrintShare( p, ThData );
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        ABC_FREE( ThData[i].pRing );
+        ABC_FREE( ThData[i].pTails );
+    }
     Bmcs_ManStop( p );
     return RetValue;
 }
@@ -108,6 +108,7 @@ static inline double    Sat_MemMemoryHand( Sat_Mem_t * p, cla h )    { return 1.
 static inline double    Sat_MemMemoryUsed( Sat_Mem_t * p, int lrn )  { return Sat_MemMemoryHand( p, Sat_MemHandCurrent(p, lrn) );                                            }
 static inline double    Sat_MemMemoryAllUsed( Sat_Mem_t * p )        { return Sat_MemMemoryUsed( p, 0 ) + Sat_MemMemoryUsed( p, 1 );                                         }
 static inline double    Sat_MemMemoryAll( Sat_Mem_t * p )            { return 1.0 * (p->iPage[0] + p->iPage[1] + 2) * (1 << (p->nPageSize+2));                               }
+static inline double    Sat_MemMemoryResident( Sat_Mem_t * p )       { int i, n = 0; for ( i = 0; i < p->nPagesAlloc; i++ ) n += (p->pPages[i] != NULL); return 1.0 * n * (1 << (p->nPageSize+2)); }
 
 // p is memory storage
 // c is clause pointer
@@ -353,6 +354,33 @@ static inline void Sat_MemShrink( Sat_Mem_t * p, int h, int lrn )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Frees the pages past the end of the clause memory.]
+
+  Description [Frees the pages of problem (lrn = 0) or learned (lrn = 1) 
+  clauses that follow the current page, except for the nSpare pages right 
+  after it, which are kept for the clauses to be added next. The freed 
+  pages are allocated again by Sat_MemAppend() when needed. Returns the 
+  number of freed pages.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sat_MemFreeUnused( Sat_Mem_t * p, int lrn, int nSpare )
+{
+    int i, Counter = 0;
+    for ( i = p->iPage[lrn] + 2 * (nSpare + 1); i < p->nPagesAlloc; i += 2 )
+        if ( p->pPages[i] )
+        {
+            ABC_FREE( p->pPages[i] );
+            Counter++;
+        }
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Compacts learned clauses by removing marked entries.]
@@ -132,6 +132,20 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// The watch list of a literal contains the clauses watching its negation.
+// A two-literal clause takes one entry, which is the other literal encoded
+// by clause_from_lit() (an odd number). A longer clause takes two entries:
+// its handle (an even number) followed by a blocker literal, which is some
+// other literal of the clause. If the blocker is true, the clause is
+// satisfied and its memory is not visited during propagation.
+static inline void     sat_solver_watch_push(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s,l);
+    assert( !clause_is_lit(h) );
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -586,8 +600,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch_push(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_watch_push(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -1018,8 +1040,9 @@ static void sat_solver_analyze(sat_solver* s, int h, veci* learnt)
 int sat_solver_propagate(sat_solver* s)
 {
     int     hConfl = 0;
+    clause* c;
     lit*    lits;
-    lit false_lit;
+    lit false_lit, blocker;
 
     //printf("sat_solver_propagate\n");
     while (hConfl == 0 && s->qtail - s->qhead > 0){
@@ -1052,7 +1075,7 @@ int sat_solver_propagate(sat_solver* s)
         veci* ws    = sat_solver_read_wlist(s,p);
         int*  begin = veci_begin(ws);
         int*  end   = begin + veci_size(ws);
-        int*i, *j;
+        int*i, *j, nBlockers = 0;
 
         s->stats.propagations++;
 //        s->simpdb_props--;
@@ -1062,23 +1085,35 @@ int sat_solver_propagate(sat_solver* s)
             if (clause_is_lit(*i)){
 
                 int Lit = clause_read_lit(*i);
-                if (var_value(s, lit_var(Lit)) == lit_sign(Lit)){
-                    *j++ = *i++;
+                *j++ = *i++;
+                if (var_value(s, lit_var(Lit)) == lit_sign(Lit))
                     continue;
-                }
 
-                *j++ = *i;
-                if (!sat_solver_enqueue(s,clause_read_lit(*i),clause_from_lit(p))){
+                if (!sat_solver_enqueue(s,Lit,clause_from_lit(p))){
                     hConfl = s->hBinary;
                     (clause_begin(s->binary))[1] = lit_neg(p);
-                    (clause_begin(s->binary))[0] = clause_read_lit(*i++);
+                    (clause_begin(s->binary))[0] = Lit;
                     // Copy the remaining watches:
-                    while (i < end)
+                    while (i < end){
+                        if (!clause_is_lit(*i)){
+                            *j++ = *i++;
+                            nBlockers++;
+                        }
                         *j++ = *i++;
+                    }
                 }
             }else{
 
-                clause* c = clause_read(s,*i);
+                // If the blocker is true, then clause is already satisfied.
+                blocker = i[1];
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    nBlockers++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1090,8 +1125,11 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                    nBlockers++;
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1100,27 +1138,37 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch_push(s,lit_neg(lits[1]),*i,lits[0]);
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
+                    nBlockers++;
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
-                        while (i < end)
+                        while (i < end){
+                            if (!clause_is_lit(*i)){
+                                *j++ = *i++;
+                                nBlockers++;
+                            }
                             *j++ = *i++;
+                        }
+                        continue;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
-        s->stats.inspects += j - veci_begin(ws);
+        // the blockers are not counted, so that the limit on inspects is not changed
+        s->stats.inspects += j - veci_begin(ws) - nBlockers;
         veci_resize(ws,j - veci_begin(ws));
 #ifdef TEST_CNF_LOAD
         }
@@ -1130,6 +1178,35 @@ int sat_solver_propagate(sat_solver* s)
     return hConfl;
 }
 
+// Measures the propagation throughput. Each dive assigns the variables
+// picked at random to random values, propagating after each assignment,
+// until a conflict is found, and then backtracks to the top level.
+// The solver is not otherwise changed, except for the saved polarities.
+// Returns the number of propagated literals or -1 if the top-level
+// propagation leads to a conflict.
+ABC_INT64_T sat_solver_propagate_bench(sat_solver* s, int nDives, int Seed)
+{
+    ABC_INT64_T nProps = s->stats.propagations;
+    double seed = 91648253 + Seed;
+    int d, n, v;
+    assert(sat_solver_dl(s) == 0);
+    if (sat_solver_propagate(s))
+        return -1;
+    for (d = 0; d < nDives; d++){
+        for (n = 0; n < s->size; n++){
+            v = irand(&seed, s->size);
+            if (var_value(s, v) != varX)
+                continue;
+            veci_push(&s->trail_lim,s->qtail);
+            sat_solver_enqueue(s,toLitCond(v, irand(&seed, 2)),0);
+            if (sat_solver_propagate(s))
+                break;
+        }
+        sat_solver_canceluntil(s,0);
+    }
+    return s->stats.propagations - nProps;
+}
+
 //=================================================================================================
 // External solver functions:
 
@@ -1389,6 +1466,8 @@ void sat_solver_restart( sat_solver* s )
 {
     int i;
     Sat_MemRestart( &s->Mem );
+    s->nPagesFreed += Sat_MemFreeUnused( &s->Mem, 0, 1 );
+    s->nPagesFreed += Sat_MemFreeUnused( &s->Mem, 1, 1 );
     s->hLearnts = -1;
     s->hBinary = Sat_MemAppend( &s->Mem, NULL, 2, 0, 0 );
     s->binary = clause_read( s, s->hBinary );
@@ -1507,7 +1586,7 @@ double sat_solver_memory( sat_solver* s )
     Mem += s->act_clas.cap * sizeof(int);
     Mem += s->temp_clause.cap * sizeof(int);
     Mem += s->conf_final.cap * sizeof(int);
-    Mem += Sat_MemMemoryAll( &s->Mem );
+    Mem += Sat_MemMemoryResident( &s->Mem );
     return Mem;
 }
 
@@ -1612,12 +1691,18 @@ void sat_solver_reducedb(sat_solver* s)
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[++k]; // blocker
+            }
             else 
             {
-                c = clause_read(s, pArray[k]);
+                c = clause_read(s, pArray[k++]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k]; // blocker
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1627,12 +1712,17 @@ void sat_solver_reducedb(sat_solver* s)
     Counter = Sat_MemCompactLearned( pMem, 1 );
     assert( Counter == (int)s->stats.learnts );
 
+    // release the pages emptied by the move
+    s->nPagesFreed += Sat_MemFreeUnused( pMem, 1, 1 );
+
     // report the results
     TimeTotal += Abc_Clock() - clk;
     if ( s->fVerbose )
     {
     Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
         s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
+    Abc_Print(1, "Clause mem: used %7.2f MB  resident %7.2f MB  freed %6d pages  ",
+        Sat_MemMemoryAllUsed(pMem) / (1<<20), Sat_MemMemoryResident(pMem) / (1<<20), s->nPagesFreed );
     Abc_PrintTime( 1, "Time", TimeTotal );
     }
 }
@@ -1678,8 +1768,11 @@ void sat_solver_rollback( sat_solver* s )
                 if ( clause_read_lit(pArray[k]) < s->iVarPivot*2 )
                     pArray[j++] = pArray[k];
             }
-            else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
-                pArray[j++] = pArray[k];
+            else if ( Sat_MemClauseUsed(pMem, pArray[k++]) )
+            {
+                pArray[j++] = pArray[k-1];
+                pArray[j++] = pArray[k]; // blocker
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -64,6 +64,7 @@ extern int         sat_solver_nclauses(sat_solver* s);
 extern int         sat_solver_nconflicts(sat_solver* s);
 extern double      sat_solver_memory(sat_solver* s);
 extern int         sat_solver_count_assigned(sat_solver* s);
+extern ABC_INT64_T sat_solver_propagate_bench(sat_solver* s, int nDives, int Seed);
 
 extern int         sat_solver_addvar(sat_solver* s);
 extern void        sat_solver_setnvars(sat_solver* s,int n);
@@ -166,6 +167,7 @@ struct sat_solver_t
     int         nLearntDelta;  // delta of learned clause limit
     int         nLearntRatio;  // ratio percentage of learned clauses
     int         nDBreduces;    // number of DB reductions
+    int         nPagesFreed;   // number of clause memory pages freed
 
     ABC_INT64_T nConfLimit;    // external limit on the number of conflicts
     ABC_INT64_T nInsLimit;     // external limit on the number of implications
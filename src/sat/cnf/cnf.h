@@ -51,6 +51,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Cnf_Man_t_            Cnf_Man_t;
 typedef struct Cnf_Dat_t_            Cnf_Dat_t;
 typedef struct Cnf_Cut_t_            Cnf_Cut_t;
+typedef struct Cnf_File_t_           Cnf_File_t;
 
 // the CNF asserting outputs of AIG to be 1
 struct Cnf_Dat_t_
@@ -129,6 +130,7 @@ static inline void         Cnf_ObjSetBestCut( Aig_Obj_t * pObj, Cnf_Cut_t * pCut
 extern Vec_Int_t *     Cnf_DeriveMappingArray( Aig_Man_t * pAig );
 extern Cnf_Dat_t *     Cnf_Derive( Aig_Man_t * pAig, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs );
+extern int             Cnf_DeriveIntoFile( Aig_Man_t * pAig, int nOutputs, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals );
 extern Cnf_Dat_t *     Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin );
 extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
 extern void            Cnf_ManPrepare();
@@ -163,6 +165,9 @@ extern void            Cnf_DataLiftAndFlipLits( Cnf_Dat_t * p, int nVarsPlus, Ve
 extern void            Cnf_DataPrint( Cnf_Dat_t * p, int fReadable );
 extern void            Cnf_DataWriteIntoFile( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vForAlls, Vec_Int_t * vExists );
 extern void            Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, Vec_Int_t * vExists1, Vec_Int_t * vForAlls, Vec_Int_t * vExists2 );
+extern Cnf_File_t *    Cnf_FileStart( char * pFileName, int nVars, int nClauses );
+extern void            Cnf_FileAddClause( Cnf_File_t * p, int * pLits, int nLits );
+extern word            Cnf_FileStop( Cnf_File_t * p );
 extern void *          Cnf_DataWriteIntoSolver( Cnf_Dat_t * p, int nFrames, int fInit );
 extern void *          Cnf_DataWriteIntoSolverInt( void * pSat, Cnf_Dat_t * p, int nFrames, int fInit );
 extern int             Cnf_DataWriteOrClause( void * pSat, Cnf_Dat_t * pCnf );
@@ -187,6 +192,7 @@ extern Cnf_Dat_t *     Cnf_DataReadFromFile( char * pFileName );
 extern Vec_Int_t *     Cnf_ManWriteCnfMapping( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern void            Cnf_SopConvertToVector( char * pSop, int nCubes, Vec_Int_t * vCover );
 extern Cnf_Dat_t *     Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs );
+extern int             Cnf_ManWriteCnfIntoFile( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals );
 extern Cnf_Dat_t *     Cnf_ManWriteCnfOther( Cnf_Man_t * p, Vec_Ptr_t * vMapped );
 extern Cnf_Dat_t *     Cnf_DeriveSimple( Aig_Man_t * p, int nOutputs );
 extern Cnf_Dat_t *     Cnf_DeriveSimpleForRetiming( Aig_Man_t * p );
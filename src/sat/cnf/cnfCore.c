@@ -167,6 +167,39 @@ Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
     Cnf_ManPrepare();
     return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF for the AIG into a file without deriving it.]
+
+  Description [Performs the same mapping as Cnf_Derive() and writes the
+  clauses into the file as they are generated (see 
+  Cnf_ManWriteCnfIntoFile). Returns 0 if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_DeriveIntoFile( Aig_Man_t * pAig, int nOutputs, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    Cnf_Man_t * p;
+    Vec_Ptr_t * vMapped;
+    Aig_MmFixed_t * pMemCuts;
+    int RetValue;
+    Cnf_ManPrepare();
+    p = s_pManCnf;
+    p->pManAig = pAig;
+    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    Cnf_DeriveMapping( p );
+    Cnf_ManTransferCuts( p );
+    vMapped = Cnf_ManScanMapping( p, 1, 1 );
+    RetValue = Cnf_ManWriteCnfIntoFile( p, vMapped, nOutputs, pFileName, fChangePol, pnVars, pnClauses, pnLiterals );
+    Vec_PtrFree( vMapped );
+    Aig_MmFixedStop( pMemCuts, 0 );
+    Aig_ManResetRefs( pAig );
+    return RetValue;
+}
  
 /**Function*************************************************************
 
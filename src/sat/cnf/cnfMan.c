@@ -472,6 +472,98 @@ void Cnf_DataWriteIntoFileInv( Cnf_Dat_t * p, char * pFileName, int fReadable, V
     fclose( pFile );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF into a file one clause at a time.]
+
+  Description [The caller gives the numbers of variables and clauses,
+  which are written in the header. The clauses are given as arrays of
+  literals of Cnf_Dat_t (2*Var+Compl) and are written the same way as
+  by Cnf_DataWriteIntoFile(). The text is accumulated in a buffer, which
+  is flushed into the file when it is full. The file is compressed if
+  its name ends in ".gz". Returns NULL if the file cannot be opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define CNF_FILE_BUFFER (1<<20)
+struct Cnf_File_t_
+{
+    FILE *          pFile;           // the text file
+    gzFile          pGzFile;         // the compressed file
+    Vec_Str_t *     vBuffer;         // the output buffer
+    int             nClauses;        // the number of clauses declared
+    int             nClausesOut;     // the number of clauses written
+    word            nLitsOut;        // the number of literals written
+    word            nBytesOut;       // the number of bytes written
+};
+static void Cnf_FileFlush( Cnf_File_t * p )
+{
+    if ( Vec_StrSize(p->vBuffer) == 0 )
+        return;
+    if ( p->pGzFile )
+        gzwrite( p->pGzFile, Vec_StrArray(p->vBuffer), (unsigned)Vec_StrSize(p->vBuffer) );
+    else
+        fwrite( Vec_StrArray(p->vBuffer), 1, (size_t)Vec_StrSize(p->vBuffer), p->pFile );
+    p->nBytesOut += Vec_StrSize(p->vBuffer);
+    Vec_StrClear( p->vBuffer );
+}
+Cnf_File_t * Cnf_FileStart( char * pFileName, int nVars, int nClauses )
+{
+    Cnf_File_t * p = ABC_CALLOC( Cnf_File_t, 1 );
+    if ( !strncmp(pFileName+strlen(pFileName)-3,".gz",3) ) 
+        p->pGzFile = gzopen( pFileName, "wb" );
+    else
+        p->pFile = fopen( pFileName, "w" );
+    if ( p->pFile == NULL && p->pGzFile == NULL )
+    {
+        printf( "Cnf_FileStart(): Output file cannot be opened.\n" );
+        ABC_FREE( p );
+        return NULL;
+    }
+    p->vBuffer  = Vec_StrAlloc( CNF_FILE_BUFFER + 1000 );
+    p->nClauses = nClauses;
+    Vec_StrPrintStr( p->vBuffer, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    Vec_StrPrintStr( p->vBuffer, "p cnf " );
+    Vec_StrPrintNum( p->vBuffer, nVars );
+    Vec_StrPush( p->vBuffer, ' ' );
+    Vec_StrPrintNum( p->vBuffer, nClauses );
+    Vec_StrPush( p->vBuffer, '\n' );
+    return p;
+}
+void Cnf_FileAddClause( Cnf_File_t * p, int * pLits, int nLits )
+{
+    int i;
+    for ( i = 0; i < nLits; i++ )
+    {
+        Vec_StrPrintNum( p->vBuffer, Cnf_Lit2Var(pLits[i]) );
+        Vec_StrPush( p->vBuffer, ' ' );
+    }
+    Vec_StrPush( p->vBuffer, '0' );
+    Vec_StrPush( p->vBuffer, '\n' );
+    p->nClausesOut++;
+    p->nLitsOut += nLits;
+    if ( Vec_StrSize(p->vBuffer) >= CNF_FILE_BUFFER )
+        Cnf_FileFlush( p );
+}
+word Cnf_FileStop( Cnf_File_t * p )
+{
+    word nBytes;
+    assert( p->nClausesOut == p->nClauses );
+    Vec_StrPush( p->vBuffer, '\n' );
+    Cnf_FileFlush( p );
+    if ( p->pGzFile )
+        gzclose( p->pGzFile );
+    else
+        fclose( p->pFile );
+    nBytes = p->nBytesOut;
+    Vec_StrFree( p->vBuffer );
+    ABC_FREE( p );
+    return nBytes;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes CNF into a file.]
@@ -807,6 +807,67 @@ void Cnf_SplitSat(char *pFileName, int iVarBeg, int iVarEnd, int nLits, int Valu
     Vec_IntFreeP(&vSol);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the propagation throughput of the SAT solver.]
+
+  Description [Derives the CNF of the AIG using Cnf_Derive(), loads it 
+  into the solver and performs the given number of random dives (see 
+  sat_solver_propagate_bench). If fMiter is set, the outputs are asserted 
+  to be true, as in the combinational equivalence checking. If nConfs is 
+  given, the solver is run with this conflict limit before the dives, so 
+  that the watch lists also contain the learned clauses.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DataBenchPropagate( Aig_Man_t * pAig, int nDives, int nConfs, int Seed, int fMiter, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Cnf_Dat_t * pCnf = Cnf_Derive( pAig, fMiter ? 0 : Aig_ManCoNum(pAig) );
+    sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    ABC_INT64_T nProps;
+    int status;
+    printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d.  ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    if ( pSat == NULL )
+    {
+        printf( "The problem is UNSAT after adding the clauses.\n" );
+        Cnf_DataFree( pCnf );
+        return;
+    }
+    if ( nConfs > 0 )
+    {
+        clk = Abc_Clock();
+        status = sat_solver_solve( pSat, NULL, NULL, (ABC_INT64_T)nConfs, 0, 0, 0 );
+        printf( "Learned clauses = %d.  Status = %s.  ", (int)pSat->stats.learnts, status == l_True ? "SAT" : status == l_False ? "UNSAT" : "UNDEC" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        if ( status == l_False )
+        {
+            sat_solver_delete( pSat );
+            Cnf_DataFree( pCnf );
+            return;
+        }
+    }
+    clk = Abc_Clock();
+    nProps = sat_solver_propagate_bench( pSat, nDives, Seed );
+    clk = Abc_Clock() - clk;
+    if ( nProps == -1 )
+        printf( "The problem is UNSAT after the top-level propagation.\n" );
+    else
+    {
+        printf( "Dives = %d.  Props = %.0f.  Inspects = %.0f.  ", nDives, (double)nProps, (double)pSat->stats.inspects );
+        printf( "Props/sec = %.2f M.  ", 1.0 * nProps / Abc_MaxInt(1, clk) * CLOCKS_PER_SEC / 1000000 );
+        Abc_PrintTime( 1, "Time", clk );
+    }
+    if ( fVerbose )
+        printf( "Solver memory = %.2f MB.\n", sat_solver_memory(pSat) / (1<<20) );
+    sat_solver_delete( pSat );
+    Cnf_DataFree( pCnf );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
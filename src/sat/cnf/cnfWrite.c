@@ -27,6 +27,13 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+static inline void Cnf_ManWriteCnfFlipLits( int * pLits, int nLits, char * pVarPols )
+{
+    int i;
+    for ( i = 0; i < nLits; i++ )
+        pLits[i] ^= pVarPols[pLits[i] >> 1];
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -403,6 +410,161 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     return pCnf;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF for the mapping directly into a file.]
+
+  Description [Produces the same file as Cnf_ManWriteCnf() followed by
+  the optional Cnf_DataTranformPolarity() and Cnf_DataWriteIntoFile(),
+  without creating the clause arrays. The clauses are counted in the
+  first pass and written in the second pass, so that the memory used
+  is proportional to the AIG size. Returns 0 if the file cannot be
+  opened.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_ManWriteCnfIntoFile( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs, char * pFileName, int fChangePol, int * pnVars, int * pnClauses, int * pnLiterals )
+{
+    Aig_Obj_t * pObj;
+    Cnf_File_t * pFile;
+    Cnf_Cut_t * pCut;
+    Vec_Int_t * vCover, * vSopTemp;
+    int OutVar, PoVar, pVars[32], pLits[40], * pVarNums;
+    char * pVarPols;
+    unsigned uTruth;
+    int i, k, c, nLits, nLiterals, nClauses, Cube, Number;
+
+    // count the number of literals and clauses
+    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        pCut = Cnf_ObjBestCut( pObj );
+        for ( c = 1; c >= 0; c-- )
+        {
+            if ( pCut->nFanins < 5 )
+            {
+                uTruth = 0xFFFF & (c ? *Cnf_CutTruth(pCut) : ~*Cnf_CutTruth(pCut));
+                nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+                nClauses += p->pSopSizes[uTruth];
+            }
+            else
+            {
+                nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[c], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[c]);
+                nClauses += Vec_IntSize(pCut->vIsop[c]);
+            }
+        }
+    }
+
+    // assign variables in the same order as Cnf_ManWriteCnf()
+    pVarNums = ABC_FALLOC( int, Aig_ManObjNumMax(p->pManAig) );
+    Number = 1;
+    if ( nOutputs )
+    {
+        if ( Aig_ManRegNum(p->pManAig) == 0 )
+        {
+            assert( nOutputs == Aig_ManCoNum(p->pManAig) );
+            Aig_ManForEachCo( p->pManAig, pObj, i )
+                pVarNums[pObj->Id] = Number++;
+        }
+        else
+        {
+            assert( nOutputs == Aig_ManRegNum(p->pManAig) );
+            Aig_ManForEachLiSeq( p->pManAig, pObj, i )
+                pVarNums[pObj->Id] = Number++;
+        }
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    Aig_ManForEachCi( p->pManAig, pObj, i )
+        pVarNums[pObj->Id] = Number++;
+    pVarNums[Aig_ManConst1(p->pManAig)->Id] = Number++;
+
+    // the polarity of the variables (see Cnf_DataTranformPolarity)
+    pVarPols = ABC_CALLOC( char, Number );
+    if ( fChangePol )
+    {
+        Aig_ManForEachObj( p->pManAig, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && pVarNums[pObj->Id] >= 0 )
+                pVarPols[pVarNums[pObj->Id]] = pObj->fPhase;
+    }
+
+    pFile = Cnf_FileStart( pFileName, Number, nClauses );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pVarNums );
+        ABC_FREE( pVarPols );
+        return 0;
+    }
+    vSopTemp = Vec_IntAlloc( 1 << 16 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        pCut = Cnf_ObjBestCut( pObj );
+        OutVar = pVarNums[ pObj->Id ];
+        for ( k = 0; k < (int)pCut->nFanins; k++ )
+            pVars[k] = pVarNums[ pCut->pFanins[k] ];
+        // positive and negative polarity of the cut
+        for ( c = 1; c >= 0; c-- )
+        {
+            if ( pCut->nFanins < 5 )
+            {
+                uTruth = 0xFFFF & (c ? *Cnf_CutTruth(pCut) : ~*Cnf_CutTruth(pCut));
+                Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+                vCover = vSopTemp;
+            }
+            else
+                vCover = pCut->vIsop[c];
+            Vec_IntForEachEntry( vCover, Cube, k )
+            {
+                pLits[0] = 2 * OutVar + !c;
+                nLits = 1 + Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits + 1 );
+                Cnf_ManWriteCnfFlipLits( pLits, nLits, pVarPols );
+                Cnf_FileAddClause( pFile, pLits, nLits );
+            }
+        }
+    }
+    Vec_IntFree( vSopTemp );
+
+    // write the constant literal
+    pLits[0] = 2 * pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
+    Cnf_ManWriteCnfFlipLits( pLits, 1, pVarPols );
+    Cnf_FileAddClause( pFile, pLits, 1 );
+
+    // write the output literals
+    Aig_ManForEachCo( p->pManAig, pObj, i )
+    {
+        OutVar = pVarNums[ Aig_ObjFanin0(pObj)->Id ];
+        if ( i < Aig_ManCoNum(p->pManAig) - nOutputs )
+        {
+            pLits[0] = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            Cnf_ManWriteCnfFlipLits( pLits, 1, pVarPols );
+            Cnf_FileAddClause( pFile, pLits, 1 );
+        }
+        else
+        {
+            PoVar = pVarNums[ pObj->Id ];
+            pLits[0] = 2 * PoVar; 
+            pLits[1] = 2 * OutVar + !Aig_ObjFaninC0(pObj); 
+            Cnf_ManWriteCnfFlipLits( pLits, 2, pVarPols );
+            Cnf_FileAddClause( pFile, pLits, 2 );
+            pLits[0] = 2 * PoVar + 1; 
+            pLits[1] = 2 * OutVar + Aig_ObjFaninC0(pObj); 
+            Cnf_ManWriteCnfFlipLits( pLits, 2, pVarPols );
+            Cnf_FileAddClause( pFile, pLits, 2 );
+        }
+    }
+    Cnf_FileStop( pFile );
+    ABC_FREE( pVarNums );
+    ABC_FREE( pVarPols );
+    if ( pnVars )      *pnVars     = Number;
+    if ( pnClauses )   *pnClauses  = nClauses;
+    if ( pnLiterals )  *pnLiterals = nLiterals;
+    return 1;
+}
+
 
 /**Function*************************************************************
 
@@ -83,6 +83,11 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    /* Clause sharing (accumulated over all calls) */
+    long n_exported;        /* Learnt clauses given to the export callback */
+    long n_imported;        /* Clauses added by satoko_import_clause() */
+    long n_imported_useful; /* Imported units and clauses used in conflict analysis */
 };
 
 
@@ -138,6 +143,18 @@ extern int satoko_learntnum(satoko_t *);
 extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
+
+/* Procedures to share learnt clauses among concurrent solvers.
+ * - The export callback is called with each learnt clause whose LBD does not
+ *   exceed the limit. The literals are only valid during the call.
+ * - The import callback is called at decision level 0 before each restart.
+ *   It is expected to add clauses using satoko_import_clause() and to return
+ *   SATOKO_ERR if one of them returned SATOKO_ERR.
+ * - The imported clauses should be implied by the clauses of this solver.
+ *   They are added as learnt clauses and may be removed by the reduction.
+ */
+extern void satoko_set_share(satoko_t *, void *, void (*)(void *, int *, int, int), int (*)(void *, satoko_t *), int);
+extern int  satoko_import_clause(satoko_t *, int *, int, int);
 extern void satoko_set_runid(satoko_t *, int);
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
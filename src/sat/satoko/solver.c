@@ -277,6 +277,10 @@ static inline void solver_analyze(solver_t *s, unsigned cref, vec_uint_t *learnt
 
         if (clause->f_learnt)
             clause_act_bump(s, clause);
+        if (clause->f_imported) {
+            clause->f_imported = 0;
+            s->stats.n_imported_useful++;
+        }
 
         if (clause->f_learnt && clause->lbd > 2) {
             unsigned n_levels = clause_clac_lbd(s, lits, clause->size);
@@ -349,6 +353,10 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
     solver_analyze(s, confl_cref, s->temp_lits, &bt_level, &lbd);
     s->sum_lbd += lbd;
     b_queue_push(s->bq_lbd, lbd);
+    if (s->pFuncExport && lbd <= s->share_lbd) {
+        s->pFuncExport(s->pShareUser, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
+        s->stats.n_exported++;
+    }
     solver_cancel_until(s, bt_level);
     cref = UNDEF;
     if (vec_uint_size(s->temp_lits) > 1) {
@@ -496,6 +504,7 @@ unsigned solver_clause_create(solver_t *s, vec_uint_t *lits, unsigned f_learnt)
     clause->f_mark = 0;
     clause->f_reallocd = 0;
     clause->f_deletable = f_learnt;
+    clause->f_imported = 0;
     clause->size = vec_uint_size(lits);
     memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * vec_uint_size(lits));
 
@@ -627,6 +636,9 @@ unsigned solver_propagate(solver_t *s)
 char solver_search(solver_t *s)
 {
     s->stats.n_starts++;
+    if (s->pFuncImport && solver_dlevel(s) == 0 &&
+        s->pFuncImport(s->pShareUser, s) == SATOKO_ERR)
+        return SATOKO_UNSAT;
     while (1) {
         unsigned confl_cref = solver_propagate(s);
         if (confl_cref != UNDEF) {
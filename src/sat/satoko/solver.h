@@ -106,6 +106,12 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Callbacks to share learnt clauses */
+    void   *pShareUser;
+    void  (*pFuncExport)(void *, int *, int, int);
+    int   (*pFuncImport)(void *, solver_t *);
+    unsigned share_lbd;
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -47,9 +47,15 @@ static inline void solver_clean_stats(solver_t *s)
 {
     long n_conflicts_all = s->stats.n_conflicts_all;
     long n_propagations_all = s->stats.n_propagations_all;
+    long n_exported = s->stats.n_exported;
+    long n_imported = s->stats.n_imported;
+    long n_imported_useful = s->stats.n_imported_useful;
     memset(&(s->stats), 0, sizeof(struct satoko_stats));
     s->stats.n_conflicts_all = n_conflicts_all;
     s->stats.n_propagations_all = n_propagations_all;
+    s->stats.n_exported = n_exported;
+    s->stats.n_imported = n_imported;
+    s->stats.n_imported_useful = n_imported_useful;
 }
 
 static inline void print_opts(solver_t *s)
@@ -657,6 +663,53 @@ void satoko_set_runid(satoko_t *s, int id)
     s->RunId = id;
 }
 
+void satoko_set_share(satoko_t *s, void *user, void (*export_fn)(void *, int *, int, int), int (*import_fn)(void *, satoko_t *), int lbd_limit)
+{
+    s->pShareUser = user;
+    s->pFuncExport = export_fn;
+    s->pFuncImport = import_fn;
+    s->share_lbd = lbd_limit;
+}
+
+/* Adds a clause received from another solver at decision level 0. The
+ * literals false at level 0 are dropped, and the clause is skipped if it is
+ * satisfied or has unknown variables. A unit is enqueued (the caller
+ * propagates it) and a longer clause becomes a learnt clause, which is marked
+ * to be counted as useful when it takes part in conflict analysis. Returns
+ * SATOKO_ERR if all literals are false, that is, if the problem is UNSAT. */
+int satoko_import_clause(satoko_t *s, int *lits, int size, int lbd)
+{
+    struct clause *clause;
+    unsigned cref;
+    int i;
+
+    assert(solver_dlevel(s) == 0);
+    for (i = 0; i < size; i++)
+        if (lit2var(lits[i]) >= vec_char_size(s->assigns))
+            return SATOKO_OK;
+    vec_uint_clear(s->temp_lits);
+    for (i = 0; i < size; i++) {
+        if (lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
+            return SATOKO_OK;
+        if (lit_value(s, lits[i]) == SATOKO_LIT_FALSE)
+            continue;
+        vec_uint_push_back(s->temp_lits, lits[i]);
+    }
+    s->stats.n_imported++;
+    if (vec_uint_size(s->temp_lits) == 0)
+        return SATOKO_ERR;
+    if (vec_uint_size(s->temp_lits) == 1) {
+        s->stats.n_imported_useful++;
+        return solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
+    }
+    cref = solver_clause_create(s, s->temp_lits, 1);
+    clause = clause_fetch(s, cref);
+    clause->f_imported = 1;
+    clause->lbd = (unsigned)lbd < clause->size ? (unsigned)lbd : clause->size;
+    clause_watch(s, cref);
+    return SATOKO_OK;
+}
+
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
     return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;